@@ -20,6 +20,20 @@
 #define LCD_DISPLAY_HEIGHT 2
 #define LCD_INDENT_CHARS 1
 #define LCD_DEFAULT_SCROLL_CUT_LENGTH 14
+#define LCD_NUMBER_OF_SCROLL_REGIONS 2
+#define LCD_SCROLL_GAP_LENGTH 2
+#define LCD_FIRST_ROW_SCROLL_REGION 0
+#define LCD_SECOND_ROW_SCROLL_REGION 1
+#define LCD_QUEUE_SIZE 64
+#define LCD_QUEUE_BYTES_PER_PUMP 4
+#define LCD_NUMBER_OF_CGRAM_SLOTS 8
+#define LCD_FIRST_GLYPH_CODE 0x10
+#define LCD_MISSING_GLYPH_CHAR '?'
+// HD44780 commands
+#define LCD_SET_DDRAM_ADDRESS_COMMAND 0x80
+#define LCD_SECOND_ROW_ADDRESS 0x40
+#define LCD_DISPLAY_ON_CURSOR_ON_COMMAND 0x0E
+#define LCD_DISPLAY_ON_CURSOR_OFF_COMMAND 0x0C
 
 // joystick pins configuration
 #define JOYSTICK_SW_PIN 2
@@ -47,6 +61,12 @@
 #define NOTE_F5 698
 #define TONE_DURATION 200
 #define LOSING_TONE_DURATION 500
+// synthesizer constants, Timer2 runs in fast PWM with OCR2A as top and prescaler 8, driving the pin 3 (OC2B)
+#define SYNTH_NUMBER_OF_VOICES 3
+#define SYNTH_MUSIC_VOICE 0
+#define SYNTH_TIMER_TOP 127
+#define SYNTH_SAMPLE_RATE 15625 // F_CPU / 8 / (SYNTH_TIMER_TOP + 1)
+#define SYNTH_VOICE_AMPLITUDE ((SYNTH_TIMER_TOP + 1) / SYNTH_NUMBER_OF_VOICES)
 
 // snake game configuration
 #define INITIAL_SNAKE_NUMBER_OF_LIVES 3
@@ -60,21 +80,31 @@
 #define MAX_SCORE_VALUE 999
 #define MAX_GAME_END_MESSAGE_LENGTH 82
 
+// replay configuration
+#define REPLAY_LOG_SIZE 128
+#define SERIAL_COMMAND_MAX_LENGTH 8
+#define SERIAL_READ_TIMEOUT 1000
+
+// ghost replay configuration
+#define GHOST_LENGTH 3
+#define GHOST_BLINK_TIME 100
+
 // time constants
 #define FOOD_BLINK_TIME 500
+#define TICK_LATENESS_TOLERANCE 2 // millis() may step by 2, a tick later than this missed its deadline
+#define PAUSED_JOYSTICK_POLL_INTERVAL 50
+#define POWER_SAVE_TIMEOUT 30000
+#define POWER_DUTY_CYCLE_WINDOW 1000
 #define INTRO_MESSAGE_TIME_IN_MILLIS 11000
 #define PRINT_MESSAGE_SCROLL_DELAY 750
 #define QUARTER_SECOND_IN_MILLIS 250
 #define NOTE_DURATION_SCALAR .9
 
-// settings menu's sections instead of enum
-#define CHANGE_NAME 1
-#define CHANGE_LCD_CONTRAST 2
-#define CHANGE_LCD_BRIGHTNESS 3
-#define CHANGE_MATRIX_BRIGHTNESS 4
-#define CHANGE_DIFFICULTY 5
-#define RESET_HIGHSCORES 6
-#define CHANGE_SOUND_ON_OFF 7
+// settings changed with a slider in the settings menu
+#define LCD_CONTRAST_SLIDER 0
+#define LCD_BRIGHTNESS_SLIDER 1
+#define MATRIX_BRIGHTNESS_SLIDER 2
+#define DIFFICULTY_SLIDER 3
 
 // settings slider constants
 #define MAX_LCD_CONTRAST_BLOCK_COUNT 12
@@ -86,6 +116,7 @@
 #define MAX_CONTRAST_VALUE 90
 #define MIN_LCD_BRIGHTNESS_VALUE 25
 #define MAX_LCD_BRIGHTNESS_VALUE 255
+#define LCD_DIMMED_BRIGHTNESS_VALUE 5
 #define MIN_MATRIX_BRIGHTNESS_VALUE 1
 #define MAX_MATRIX_BRIGHTNESS_VALUE 15
 #define MIN_DIFFICULTY_LEVEL 1
@@ -93,10 +124,64 @@
 #define NUMBER_OF_HIGHSCORES_SAVED 5
 #define MAX_PLAYER_NAME_LENGTH 6
 
-// storage eeprom offsets
-#define SETTINGS_OFFSET_IN_STORAGE 0
-// highscores offset is the size of the settingsData struct
+// lifetime statistics shown in the stats menu
+#define STAT_GAMES_PLAYED 0
+#define STAT_FOOD_EATEN 1
+#define STAT_LONGEST_SNAKE 2
+#define STAT_WALL_DEATHS 3
+#define STAT_SELF_DEATHS 4
+#define STAT_STARVATION_DEATHS 5
+#define STAT_GAMES_WON 6
+#define STAT_PLAY_TIME_MINUTES 7
+#define NUMBER_OF_GAME_END_CAUSES 4
+
+// diagnostics shown on the hidden diagnostics page, opened by holding the switch during the intro
+#define DIAGNOSTIC_FREE_MEMORY 0
+#define DIAGNOSTIC_MIN_FREE_MEMORY 1
+#define DIAGNOSTIC_STACK_PEAK 2
+#define DIAGNOSTIC_LOOPS_PER_SECOND 3
+#define DIAGNOSTIC_WORST_LOOP_MICROS 4
+#define DIAGNOSTIC_TICK_JITTER 5
+#define DIAGNOSTIC_LCD_BYTES_PER_SECOND 6
+#define DIAGNOSTIC_MATRIX_BYTES_PER_SECOND 7
+#define DIAGNOSTIC_LATE_TICKS 8
+#define DIAGNOSTIC_SKIPPED_TICKS 9
+#define DIAGNOSTICS_STACK_PAINT 0xC5
+#define DIAGNOSTICS_REFRESH_INTERVAL 500
+#define DIAGNOSTICS_WINDOW 1000
+
+// storage eeprom layout, each record has a ring of slots of a header and at most the record capacity bytes
+#define SETTINGS_RECORD_OFFSET 0
+#define SETTINGS_RECORD_CAPACITY 16
+#define SETTINGS_RECORD_SLOTS 4
+#define SETTINGS_RECORD_VERSION 1
+#define HIGHSCORES_RECORD_OFFSET 80
+#define HIGHSCORES_RECORD_CAPACITY 30
+#define HIGHSCORES_RECORD_SLOTS 2
+#define HIGHSCORES_RECORD_VERSION 2
+#define STATS_RECORD_OFFSET 352
+#define STATS_RECORD_CAPACITY 24
+#define STATS_RECORD_SLOTS 5
+#define STATS_RECORD_VERSION 1
+#define GHOST_OFFSET_IN_STORAGE 512
+#define GHOST_SIZE_IN_STORAGE 136
+#define GHOST_STORAGE_MARKER 0xA7
+#define SNAPSHOT_RECORD_OFFSET 648
+#define SNAPSHOT_RECORD_CAPACITY 32
+#define SNAPSHOT_RECORD_SLOTS 2
+#define SNAPSHOT_RECORD_VERSION 1
+#define STORAGE_SIZE 1024
 
 #define MAX_DIGITAL_OUTPUT_VALUE 255
 
+// watchdog resetting the unit in the main menu when the main loop stalls, set WATCHDOG_ENABLED to 0 to disable it
+// the watchdog interrupt comes after the timeout (~2s) and the reset after another timeout
+#define WATCHDOG_ENABLED 1
+#define WATCHDOG_PRESCALER_BITS (_BV(WDP2) | _BV(WDP1) | _BV(WDP0))
+#define WATCHDOG_RESET_MARK 0x57A1
+
+// sram budget of the singletons, all allocated statically, the rest of the 2KB is left for the other globals, the
+// core and the stack
+#define SINGLETONS_SRAM_BUDGET 1280
+
 #endif
\ No newline at end of file
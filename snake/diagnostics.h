@@ -0,0 +1,288 @@
+/**
+ * File for the Diagnostics class
+ * The Diagnostics class is a singleton class that measures the SRAM headroom of the unit. Before main() runs, the free
+ * SRAM between the static data and the top of the stack is painted with DIAGNOSTICS_STACK_PAINT. The stack overwrites
+ * the paint as it grows, and the paint never gets back, so the painted bytes left above the end of the heap are the
+ * lowest free memory the unit ever had, the high-water mark of the stack. The current free memory is probed as the
+ * distance between the end of the heap and a local variable.
+ * The performance of the unit is measured over windows of DIAGNOSTICS_WINDOW: the main loop iterations per second, the
+ * worst time between two iterations, the worst lateness of the snake's ticks against the snake speed and the bytes per
+ * second sent to the LCD and to the matrix. The ticks later than TICK_LATENESS_TOLERANCE and the ticks skipped are
+ * counted since boot. The values are shown on the hidden diagnostics page of the menu and the memory and ticks
+ * measurements are also written over Serial
+ */
+
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include "config.h"
+#include "lcd.h"
+#include "matrix.h"
+
+extern char _end; // end of the static data, set by the linker
+extern char __heap_start;
+extern char *__brkval; // end of the heap, nullptr while nothing was allocated
+
+/**
+ * Function that paints the free SRAM with DIAGNOSTICS_STACK_PAINT before main() runs. It is placed in the .init3
+ * section, after the stack pointer and the zero register are set, and is naked so it doesn't use the stack it paints
+ * No @params
+ * No @return
+ */
+void paintStack() __attribute__((naked, used, section(".init3")));
+
+void paintStack() {
+  for (char *address = &_end; address <= (char *) RAMEND; address++) {
+    *address = DIAGNOSTICS_STACK_PAINT;
+  }
+}
+
+class Diagnostics {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Diagnostics *getInstance() {
+    static Diagnostics instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that updates the high-water mark of the stack and measures the main loop, the values of the window are
+   * computed at the end of each DIAGNOSTICS_WINDOW
+   * Needs to be called once per iteration of the main loop
+   * No @params
+   * No @return
+   */
+  void update() {
+    updateStackHighWaterMark();
+
+    unsigned long currentMicros = micros();
+    windowWorstLoopMicros = max(windowWorstLoopMicros, currentMicros - lastUpdateMicros);
+    lastUpdateMicros = currentMicros;
+    windowLoops++;
+
+    unsigned long windowTime = millis() - windowStartTimestamp;
+    if (windowTime >= DIAGNOSTICS_WINDOW) {
+      loopsPerSecond = getPerSecond(windowLoops, windowTime);
+      worstLoopMicros = min(windowWorstLoopMicros, 65535UL);
+      lcdBytesPerSecond = getPerSecond(lcd->getBytesSent() - windowStartLcdBytes, windowTime);
+      matrixBytesPerSecond = getPerSecond(lcMatrix->getBytesSent() - windowStartMatrixBytes, windowTime);
+      if (hasWindowTicks) { // keep the jitter of the last game played while in the menu
+        tickJitter = windowWorstTickLateness;
+      }
+      startWindow();
+    }
+  }
+
+  /**
+   * Function that records a snake's tick played against its deadline, called by the game on each live tick
+   * @param lateness - the time in millis the tick came after its deadline
+   * @param skippedTicks - the number of deadlines missed and skipped before the tick
+   * No @return
+   */
+  void recordTick(const unsigned long lateness, const unsigned int skippedTicks) {
+    windowWorstTickLateness = max(windowWorstTickLateness, min(lateness, 65535UL));
+    hasWindowTicks = true;
+    if (lateness > TICK_LATENESS_TOLERANCE) {
+      lateTicks++;
+    }
+    this->skippedTicks += skippedTicks;
+  }
+
+  /**
+   * Function that probes the free memory between the end of the heap and the top of the stack
+   * No @params
+   * @return the free memory in bytes
+   */
+  unsigned int getFreeMemory() const {
+    char stackTop;
+    return &stackTop - getHeapEnd();
+  }
+
+  unsigned int getMinFreeMemory() const {
+    return minFreeMemory;
+  }
+
+  /**
+   * Function that returns the most memory the stack ever used, from the high-water mark
+   * No @params
+   * @return the size of the stack at its high-water mark in bytes
+   */
+  unsigned int getStackPeak() const {
+    return (char *) RAMEND - getHeapEnd() + 1 - minFreeMemory;
+  }
+
+  /**
+   * Function that returns a value shown on the diagnostics page
+   * @param diagnostic - the value, one of the DIAGNOSTIC_* values
+   * @return the value
+   */
+  unsigned int getDiagnostic(const byte diagnostic) const {
+    switch (diagnostic) {
+      case DIAGNOSTIC_FREE_MEMORY:
+        return getFreeMemory();
+      case DIAGNOSTIC_MIN_FREE_MEMORY:
+        return getMinFreeMemory();
+      case DIAGNOSTIC_STACK_PEAK:
+        return getStackPeak();
+      case DIAGNOSTIC_LOOPS_PER_SECOND:
+        return loopsPerSecond;
+      case DIAGNOSTIC_WORST_LOOP_MICROS:
+        return worstLoopMicros;
+      case DIAGNOSTIC_TICK_JITTER:
+        return tickJitter;
+      case DIAGNOSTIC_LCD_BYTES_PER_SECOND:
+        return lcdBytesPerSecond;
+      case DIAGNOSTIC_MATRIX_BYTES_PER_SECOND:
+        return matrixBytesPerSecond;
+      case DIAGNOSTIC_LATE_TICKS:
+        return min(lateTicks, 65535UL);
+      case DIAGNOSTIC_SKIPPED_TICKS:
+        return min(skippedTicks, 65535UL);
+      default:
+        return 0;
+    }
+  }
+
+  /**
+   * Function that writes the memory measurements on a stream as a line:
+   * MEMORY <free memory> <min free memory> <stack peak>
+   * @param stream - the stream to write to
+   * No @return
+   */
+  void writeTo(Print &stream) const {
+    stream.print(F("MEMORY "));
+    stream.print(getFreeMemory());
+    stream.print(' ');
+    stream.print(getMinFreeMemory());
+    stream.print(' ');
+    stream.println(getStackPeak());
+  }
+
+  /**
+   * Function that writes the ticks measurements on a stream as a line:
+   * TICKS <late ticks> <skipped ticks> <worst lateness of the last window with ticks>
+   * @param stream - the stream to write to
+   * No @return
+   */
+  void writeTicksTo(Print &stream) const {
+    stream.print(F("TICKS "));
+    stream.print(lateTicks);
+    stream.print(' ');
+    stream.print(skippedTicks);
+    stream.print(' ');
+    stream.println(tickJitter);
+  }
+
+private:
+  LCD *lcd = nullptr;
+  Matrix *lcMatrix = nullptr;
+
+  unsigned int minFreeMemory = 0; // painted bytes left above the end of the heap
+
+  // values of the last window ended
+  unsigned int loopsPerSecond = 0;
+  unsigned int worstLoopMicros = 0;
+  unsigned int tickJitter = 0;
+  unsigned int lcdBytesPerSecond = 0;
+  unsigned int matrixBytesPerSecond = 0;
+
+  // counters since boot
+  unsigned long lateTicks = 0;
+  unsigned long skippedTicks = 0;
+
+  // measurements of the current window
+  unsigned long windowStartTimestamp = 0;
+  unsigned long lastUpdateMicros = 0;
+  unsigned long windowWorstLoopMicros = 0;
+  unsigned long windowStartLcdBytes = 0;
+  unsigned long windowStartMatrixBytes = 0;
+  unsigned long windowLoops = 0;
+  unsigned int windowWorstTickLateness = 0;
+  bool hasWindowTicks = false;
+
+  /**
+   * Private constructor for the singleton class
+   * The constructor will get the screens to count the bytes sent to them, count the painted bytes and start the first
+   * window
+   */
+  Diagnostics() {
+    lcd = LCD::getInstance();
+    lcMatrix = Matrix::getInstance();
+
+    countPaintedBytes();
+    lastUpdateMicros = micros();
+    startWindow();
+  }
+
+  Diagnostics(const Diagnostics &) = delete;
+
+  Diagnostics &operator=(const Diagnostics &) = delete;
+
+  /**
+   * Function that counts the painted bytes above the end of the heap, the whole painted area is scanned once at boot
+   * No @params
+   * No @return
+   */
+  void countPaintedBytes() {
+    const char *heapEnd = getHeapEnd();
+    minFreeMemory = 0;
+    while (heapEnd + minFreeMemory <= (char *) RAMEND && heapEnd[minFreeMemory] == (char) DIAGNOSTICS_STACK_PAINT) {
+      minFreeMemory++;
+    }
+  }
+
+  /**
+   * Function that lowers the high-water mark of the stack, scanning down from the last painted byte below the stack
+   * while the bytes were overwritten, so only the bytes newly used by the stack are checked. A stack byte equal to the
+   * paint stops the scan until it changes, the odds of it are of 1 in 256
+   * No @params
+   * No @return
+   */
+  void updateStackHighWaterMark() {
+    const char *heapEnd = getHeapEnd();
+    while (minFreeMemory > 0 && heapEnd[minFreeMemory - 1] != (char) DIAGNOSTICS_STACK_PAINT) {
+      minFreeMemory--;
+    }
+  }
+
+  /**
+   * Function that starts a new measurement window from the current time and bytes sent
+   * No @params
+   * No @return
+   */
+  void startWindow() {
+    windowStartTimestamp = millis();
+    windowStartLcdBytes = lcd->getBytesSent();
+    windowStartMatrixBytes = lcMatrix->getBytesSent();
+    windowWorstLoopMicros = 0;
+    windowLoops = 0;
+    windowWorstTickLateness = 0;
+    hasWindowTicks = false;
+  }
+
+  /**
+   * Function that converts a count over a window to a count per second, limited to the values shown on the LCD
+   * @param count - the count over the window
+   * @param windowTime - the time of the window in millis
+   * @return the count per second
+   */
+  static unsigned int getPerSecond(const unsigned long count, const unsigned long windowTime) {
+    return min(count * 1000 / windowTime, 65535UL);
+  }
+
+  /**
+   * Function that returns the end of the heap, where the free memory starts
+   * No @params
+   * @return pointer to the first byte after the heap
+   */
+  static const char *getHeapEnd() {
+    return __brkval ? __brkval : &__heap_start;
+  }
+};
+
+#endif
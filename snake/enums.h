@@ -4,6 +4,8 @@
  * - direction on a y-axis
  * - 4 way direction in a 2d space
  * - main menu item sections
+ * - actions of the menu entries
+ * - causes of a game's end
  */
 
 #ifndef ENUMS_H
@@ -35,6 +37,31 @@ enum MenuItem {
   SETTINGS = 3,
   ABOUT = 4,
   HOW_TO_PLAY = 5,
+  STATS = 6,
+  DIAGNOSTICS = 7,
+};
+
+enum class MenuAction : byte {
+  NONE,
+  OPEN_MENU,
+  PLAY_GAME,
+  CONTINUE_GAME,
+  CHANGE_NAME,
+  CHANGE_SLIDER_SETTING,
+  RESET_HIGHSCORES,
+  TOGGLE_SOUND,
+  SHOW_HIGHSCORE,
+  SHOW_HIGHSCORES_TITLE,
+  SHOW_STAT,
+  SHOW_DIAGNOSTIC,
+};
+
+// values used as indexes of the game ends counters, NUMBER_OF_GAME_END_CAUSES needs to follow the number of causes
+enum class GameEndCause : byte {
+  WALL,
+  SELF,
+  STARVATION,
+  WON, // the snake reached the max length
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+ * File for the FlashString handle
+ * A FlashString points to a string saved in the Flash memory together with its length, computed at compile time with
+ * sizeof() when the string is created with the FLASH_STRING() macro. The string is read in place with pgm_read_byte,
+ * so neither measuring nor printing it walks the string or copies it in the RAM
+ */
+
+#ifndef FLASH_STRING_H
+#define FLASH_STRING_H
+
+/**
+ * struct for a handle to a string saved in the Flash memory
+ */
+struct FlashString {
+  PGM_P text;
+  unsigned int length;
+
+  /**
+   * Function that reads a character of the string from the Flash memory
+   * @param index - the index of the character, less than the length
+   * @return the character
+   */
+  char charAt(const unsigned int index) const {
+    return pgm_read_byte(&text[index]);
+  }
+};
+
+// save a string literal in the Flash memory and get its handle, like F() but with the length known at compile time
+#define FLASH_STRING(literal) (__extension__({ \
+  static const char flashStringText[] PROGMEM = (literal); \
+  FlashString{flashStringText, sizeof(flashStringText) - 1}; \
+}))
+
+#endif
@@ -0,0 +1,29 @@
+/**
+ * File containing the text formatting functions of the game, used instead of sprintf to not link the avr-libc's
+ * vfprintf. The numbers are written as fixed-width fields of decimal digits padded with zeros, the width being a
+ * template parameter, so the field sizes are known at compile time and a formatted text can be checked with
+ * static_assert to fit its buffer
+ */
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+/**
+ * Function that writes a number as a fixed-width field of decimal digits padded with zeros, without the string
+ * terminator. A number with more digits than the width keeps only its lowest digits
+ * @param destination - where to write the digits, with room for width characters
+ * @param value - the number to write
+ * @return pointer after the last digit written
+ */
+template<byte width>
+char *writeZeroPaddedNumber(char *destination, unsigned int value) {
+  static_assert(width > 0 && width <= 5, "an unsigned int has between 1 and 5 digits");
+
+  for (byte i = width; i > 0; i--) {
+    destination[i - 1] = '0' + value % 10;
+    value /= 10;
+  }
+  return destination + width;
+}
+
+#endif
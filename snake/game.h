@@ -15,6 +15,11 @@
 #include "lcd.h"
 #include "matrix.h"
 #include "soundDevice.h"
+#include "replay.h"
+#include "ghost.h"
+#include "stats.h"
+#include "snapshot.h"
+#include "diagnostics.h"
 
 class Game {
 public:
@@ -24,9 +29,37 @@ public:
    * @return pointer to the instance of the class
    */
   static Game *getInstance() {
-    static Game *instance = new Game();
+    static Game instance;
 
-    return instance;
+    return &instance;
+  }
+
+  /**
+   * Function that requests the next game to be a replay of the game loaded in the Replay log instead of a live game.
+   * A replay skips the start transition and runs its ticks at full speed with the joystick replaced by the log
+   * No @params
+   * No @return
+   */
+  void startReplay() {
+    isReplaying = true;
+    hasGameEnded = false;
+    inTransition = true;
+  }
+
+  /**
+   * Function that requests the next game to continue the game saved in the snapshot instead of a new game.
+   * A resumed game doesn't record a replay and doesn't show the ghost, since both follow a game from its start
+   * No @params
+   * No @return
+   */
+  void startResume() {
+    isResumed = true;
+    hasGameEnded = false;
+    inTransition = true;
+  }
+
+  bool getIsPaused() const {
+    return isPaused;
   }
 
   /**
@@ -38,47 +71,74 @@ public:
   bool play() {
     if (hasGameEnded) {
       if (inTransition) { // if the game has ended and the end transition is still running
+        if (hasSavedSnapshot) { // the game saved when it was paused can't be continued anymore
+          snapshot->erase();
+          hasSavedSnapshot = false;
+        }
         playGameEndedTransition();
+        reportReplay();
+        recordStats();
       }
 
-      // show any scrolling message if any
-      lcd->printScrollingFlashStringMessage();
-      lcd->printScrollingMessage();
+      // let the game over song play to its end
+      soundDevice->update();
 
       // user saw the game ending and his status, and requested to go back to the main menu
       if (joystick->isSwitchPressed()) {
-        // disable all scrolls
-        lcd->printScrollingMessage(true, nullptr);
-        lcd->printScrollingFlashStringMessage(true, nullptr);
+        // disable the scrolling message and the song
+        soundDevice->stopSong();
+        lcd->stopScrolling(LCD_SECOND_ROW_SCROLL_REGION);
 
         // set game status for the next game
         hasGameEnded = false;
         inTransition = true;
 
-        // save the highscore if the user has a new highscore
-        int score = getGameScoreValue(snakeLength);
-        highscores->updateHighscores(score, settings->getPlayerName());
+        // save the highscore if the user has a new highscore, replayed games were already played once
+        // the best game of all the difficulty levels is also saved as the ghost for the next games, if its replay was
+        // recorded from start to end
+        if (!isReplaying) {
+          int score = getGameScoreValue(snakeLength);
+          if (!isResumed && !replay->getIsTruncated() && ghost->isBetterGame(gameDifficulty, score)) {
+            ghost->saveFromReplay(replay, score);
+          }
+          highscores->updateHighscores(gameDifficulty, score, settings->getPlayerName());
+        }
+        isReplaying = false;
+        isResumed = false;
 
         return false; // announce that the game is over
       }
     } else {
       if (inTransition) { // if the game has not ended and the start transition is still running
-        playStartGameTransition();
+        if (isReplaying) {
+          inTransition = false;
+        } else {
+          playStartGameTransition();
+        }
 
         initGame();
         showGameStats();
         if (settings->getIsSoundOn()) {
-          soundDevice->playSong(true);
+          soundDevice->startSong(TRACK_GAME);
         }
+        lastTickDeadline = millis(); // the first tick is due one snakeSpeed after the start
       }
 
-      // play theme song while the game is running
-      if (settings->getIsSoundOn()) {
-        soundDevice->playSong();
+      if (!isReplaying && joystick->isSwitchPressed()) { // the player pauses or unpauses the game
+        setIsPaused(!isPaused);
+      }
+      if (isPaused) {
+        if (isSuspendRequested()) { // the player leaves to the menu, the game saved can be continued later
+          isPaused = false;
+          suspendGame();
+          return false; // announce that the game left to the menu
+        }
+        return true; // nothing changes until the joystick is used
       }
 
-      checkSnakeStarvationStatus();
-      checkIfGameHasEnded();
+      // play theme song while the game is running
+      soundDevice->update();
+
       if (food.x == ASKING_FOR_NEW_FOOD_VALUE || food.y == ASKING_FOR_NEW_FOOD_VALUE) { // snake ate food
         // update game status on lcd since the user progressed
         showGameStats();
@@ -89,7 +149,10 @@ public:
         lostALife = false;
       }
       displayFood(); // display blinking food on matrix
-      checkSnakeChangedDirection();
+      displayGhost(); // display the blinking ghost of the best game on matrix
+      if (!isReplaying) {
+        checkSnakeChangedDirection();
+      }
       updateSnakePosition();
     }
 
@@ -115,6 +178,13 @@ private:
 
   int snakeNumberOfLives;
   bool lostALife;
+  byte gameDifficulty;
+  unsigned long randomState = 1; // state of the game's own random generator, seeded on each game
+  /**
+   * virtual game clock in millis, advanced by snakeSpeed on each tick. All the game logic is timed by it instead of
+   * millis() so a game evolves the same when replayed at any speed
+   */
+  unsigned long gameClock;
   volatile unsigned long lastSnakeEatTimestamp;
   volatile Direction lastSnakeDirection = Direction::RIGHT;
   volatile Direction snakeDirection = Direction::RIGHT;
@@ -125,6 +195,14 @@ private:
 
   bool hasGameEnded = false;
   bool inTransition = true; // used to announce both start and end transitions, since they can't happen at the same time
+  bool isReplaying = false; // the ticks directions are read from the replay log instead of the joystick
+  bool isResumed = false; // the game continues the game saved in the snapshot
+  bool isPaused = false; // the game clock, the display and the sound are frozen
+  bool hasSavedSnapshot = false; // the game saved itself in the snapshot when it was paused
+  unsigned long pauseStartTimestamp = 0;
+  unsigned long lastTickDeadline = 0; // the ticks are due every snakeSpeed after it, not after the last tick played
+  GameEndCause gameEndCause = GameEndCause::WALL;
+  char gameEndMessage[MAX_GAME_END_MESSAGE_LENGTH]; // message scrolled on the LCD at the end of the game
 
   /**
    * Pointers to the interfaces of input & output devices to present the game
@@ -136,6 +214,11 @@ private:
 
   Settings *settings = nullptr;
   Highscores *highscores = nullptr;
+  Replay *replay = nullptr;
+  Ghost *ghost = nullptr;
+  Stats *stats = nullptr;
+  Snapshot *snapshot = nullptr;
+  Diagnostics *diagnostics = nullptr;
 
   /**
    * Private constructor for the singleton class
@@ -150,6 +233,11 @@ private:
 
     settings = Settings::getInstance();
     highscores = Highscores::getInstance();
+    replay = Replay::getInstance();
+    ghost = Ghost::getInstance();
+    stats = Stats::getInstance();
+    snapshot = Snapshot::getInstance();
+    diagnostics = Diagnostics::getInstance();
   }
 
   Game(const Game &) = delete;
@@ -171,9 +259,9 @@ private:
 
     // print name of the player message
     lcd->setCursorPosition(0, 0);
-    lcd->printMessage(F("Name: "));
+    lcd->printMessage(FLASH_STRING("Name: "));
     lcd->printMessage(settings->getPlayerName());
-    lcd->printMessage(F(" "));
+    lcd->printMessage(FLASH_STRING(" "));
 
     // print snake's remaining lives
     for (byte i = 0; i < snakeNumberOfLives; i++) {
@@ -181,17 +269,32 @@ private:
     }
 
     // print snake length message
-    char snakeLengthMessage[11];
-    sprintf(snakeLengthMessage, "SL:%.2d - D:%.1d ", snakeLength, settings->getGameDifficulty());
     lcd->setCursorPosition(0, 1);
-    lcd->printMessage(snakeLengthMessage);
+    lcd->printMessage(FLASH_STRING("SL:"));
+    lcd->printZeroPaddedNumber<2>(snakeLength);
+    lcd->printMessage(FLASH_STRING(" - D:"));
+    lcd->printZeroPaddedNumber<1>(gameDifficulty);
+    lcd->printMessage(' ');
 
     // print current score message
     lcd->printCustomChar(byte(CUP_CHAR));
-    int score = getGameScoreValue(snakeLength);
-    char scoreMessage[4];
-    sprintf(scoreMessage, "%03d", score);
-    lcd->printMessage(scoreMessage);
+    lcd->printZeroPaddedNumber<3>(getGameScoreValue(snakeLength));
+  }
+
+  /**
+   * Function that returns the glyph shown on the game end screen for the cause that ended the game
+   * @param cause - the cause that ended the game
+   * @return the code of the glyph
+   */
+  static byte getGameEndCauseChar(const GameEndCause cause) {
+    switch (cause) {
+      case GameEndCause::STARVATION:
+        return APPLE_CHAR;
+      case GameEndCause::WON:
+        return CUP_CHAR;
+      default: // the snake hit a wall or itself
+        return SKULL_CHAR;
+    }
   }
 
   /**
@@ -202,14 +305,15 @@ private:
    * @return the score computed
    */
   int getGameScoreValue(int snakeLength) {
-    return map((snakeLength - INITIAL_SNAKE_LENGTH) * settings->getGameDifficulty(),
+    return map((snakeLength - INITIAL_SNAKE_LENGTH) * gameDifficulty,
                INITIAL_SNAKE_LENGTH - INITIAL_SNAKE_LENGTH,
                (MAX_SNAKE_LENGTH - INITIAL_SNAKE_LENGTH) * MAX_DIFFICULTY_LEVEL, MIN_SCORE_VALUE,
                MAX_SCORE_VALUE);
   }
 
   /**
-   * Function that initialize the game configuration based on saved settings
+   * Function that initialize the game configuration based on saved settings, or on the replay log for a replayed game.
+   * A live game starts recording its replay log
    * No @params
    * No @return
    */
@@ -218,34 +322,176 @@ private:
 
     // reset gameMatrix to full zeros
     memset(gameMatrix, 0, sizeof(gameMatrix[0][0]) * MATRIX_SIZE * MATRIX_SIZE);
+    lostALife = false;
+    hasSavedSnapshot = false;
+
+    // a resumed game continues from the snapshot, a new game is started if the snapshot can't be loaded
+    if (isResumed) {
+      isResumed = resumeFromSnapshot();
+      if (isResumed) {
+        return;
+      }
+    }
+
+    // seed the game's random generator, a replayed game reuses the recorded seed and difficulty
+    if (isReplaying) {
+      randomState = replay->getSeed();
+      gameDifficulty = replay->getGameDifficulty();
+      replay->startPlayback();
+    } else {
+      randomState = generateRandomSeed(); // new seed to have a different game loop each time
+      gameDifficulty = settings->getGameDifficulty();
+      replay->startRecording(randomState, gameDifficulty);
+      ghost->startPlayback();
+    }
 
     // set the snake settings to initial values
-    lastSnakeEatTimestamp = millis();
+    gameClock = 0;
+    lastSnakeEatTimestamp = gameClock;
     snakeNumberOfLives = INITIAL_SNAKE_NUMBER_OF_LIVES;
-    lostALife = false;
-    snakeSpeed = map(settings->getGameDifficulty(), MIN_DIFFICULTY_LEVEL, MAX_DIFFICULTY_LEVEL, MAX_SNAKE_SPEED,
-                     MIN_SNAKE_SPEED);
+    snakeSpeed = getSnakeSpeed();
     snakeLength = INITIAL_SNAKE_LENGTH;
     snakeDirection = Direction::RIGHT;
+    lastSnakeDirection = Direction::RIGHT;
     snakeHead = {5, 2};
+    askForNewFood();
     for (byte i = 0; i <= 2; i++) { // snake body
       gameMatrix[5][i] = i + 1;
       lcMatrix->setLed(5, i, true);
     }
+  }
+
+  /**
+   * Function that computes the time between two ticks of the snake for the game's difficulty
+   * No @params
+   * @return the time between two ticks in millis
+   */
+  int getSnakeSpeed() const {
+    return map(gameDifficulty, MIN_DIFFICULTY_LEVEL, MAX_DIFFICULTY_LEVEL, MAX_SNAKE_SPEED, MIN_SNAKE_SPEED);
+  }
+
+  /**
+   * Function that pauses or unpauses the game. While paused no tick is played, so the game clock and the starvation
+   * time stand still, the display isn't updated and the song is paused. The next tick after unpausing comes as late as
+   * it would have without the pause. The game is saved in the snapshot when paused, so it can be continued even if the
+   * unit loses power while paused
+   * @param newIsPaused - true to pause the game, false to unpause it
+   * No @return
+   */
+  void setIsPaused(const bool newIsPaused) {
+    isPaused = newIsPaused;
+    if (isPaused) {
+      pauseStartTimestamp = millis();
+      saveSnapshot();
+      soundDevice->pauseSong();
+      if (food.x != ASKING_FOR_NEW_FOOD_VALUE) { // keep the food shown while its blinking is frozen
+        lcMatrix->setLed(food.x, food.y, true);
+      }
+      lcd->setCursorPosition(0, 1);
+      lcd->printMessage(GAME_PAUSED_STRING);
+    } else {
+      lastTickDeadline += millis() - pauseStartTimestamp;
+      soundDevice->resumeSong();
+      showGameStats();
+    }
+  }
+
+  /**
+   * Function that checks if the player moved the joystick to the left while the game is paused, to leave the game saved
+   * when paused. The joystick is read only every PAUSED_JOYSTICK_POLL_INTERVAL to let the MCU sleep in between
+   * No @params
+   * @return true if the player requested to leave the game, false otherwise
+   */
+  bool isSuspendRequested() {
+    static unsigned long lastPollTimestamp = 0;
+
+    if (millis() - lastPollTimestamp < PAUSED_JOYSTICK_POLL_INTERVAL) {
+      return false;
+    }
+    lastPollTimestamp = millis();
+    return joystick->detectMovementOnXAxis() == XDirection::LEFT;
+  }
 
-    configureRandomSeed(); // new random seed for generating food positions to have a different game loop each time
+  /**
+   * Function that saves the game in progress in the snapshot, replacing the game saved before. The snapshot is erased
+   * when the game ends, a game that never saved itself leaves the snapshot of another game untouched
+   * No @params
+   * No @return
+   */
+  void saveSnapshot() {
+    Snapshot::SnapshotData snapshotData;
+    snapshotData.randomState = randomState;
+    snapshotData.gameClock = gameClock;
+    snapshotData.timeSinceLastEat = gameClock - lastSnakeEatTimestamp;
+    snapshotData.head = Snapshot::packPoint(snakeHead);
+    snapshotData.food = food.x == ASKING_FOR_NEW_FOOD_VALUE ? SNAPSHOT_NO_FOOD : Snapshot::packPoint(food);
+    snapshotData.snakeLength = snakeLength;
+    snapshotData.snakeNumberOfLives = snakeNumberOfLives;
+    snapshotData.gameDifficulty = gameDifficulty;
+    snapshotData.snakeDirection = byte(snakeDirection);
+    Snapshot::encodeBody(gameMatrix, snakeHead, snakeLength, snapshotData.bodyChain);
+    snapshot->save(snapshotData);
+    hasSavedSnapshot = true;
   }
 
   /**
-   * Function that checks if the snake is starving. If the snake didn't eat in the last STARVING_TIME_INTERVAL then
-   * he will lose a life, function resets the last eat timestamp to not lose all hearts at once
+   * Function that leaves the paused game, saved in the snapshot when it was paused, so it can be continued later from
+   * the menu
+   * No @params
+   * No @return
+   */
+  void suspendGame() {
+    soundDevice->stopSong();
+    inTransition = true; // the next game starts with the start transition
+    isResumed = false;
+  }
+
+  /**
+   * Function that restores the game saved in the snapshot and erases the snapshot, so a game is continued only once
+   * No @params
+   * @return true if the game was restored, false if no valid snapshot is saved
+   */
+  bool resumeFromSnapshot() {
+    Snapshot::SnapshotData snapshotData;
+    if (!snapshot->load(snapshotData)) {
+      return false;
+    }
+    snapshot->erase();
+
+    randomState = snapshotData.randomState;
+    gameClock = snapshotData.gameClock;
+    lastSnakeEatTimestamp = gameClock - snapshotData.timeSinceLastEat;
+    snakeHead = Snapshot::unpackPoint(snapshotData.head);
+    if (snapshotData.food == SNAPSHOT_NO_FOOD) {
+      askForNewFood();
+    } else {
+      food = Snapshot::unpackPoint(snapshotData.food);
+    }
+    snakeLength = snapshotData.snakeLength;
+    snakeNumberOfLives = snapshotData.snakeNumberOfLives;
+    gameDifficulty = snapshotData.gameDifficulty;
+    snakeSpeed = getSnakeSpeed();
+    snakeDirection = Direction(snapshotData.snakeDirection);
+    lastSnakeDirection = snakeDirection;
+
+    Snapshot::decodeBody(gameMatrix, snakeHead, snakeLength, snapshotData.bodyChain);
+    for (byte i = 0; i < MATRIX_SIZE; i++) {
+      for (byte j = 0; j < MATRIX_SIZE; j++) {
+        lcMatrix->setLed(i, j, gameMatrix[i][j] > 0);
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Function that checks if the snake is starving. If the snake didn't eat in the last STARVING_TIME_INTERVAL of the
+   * game clock then he will lose a life, function resets the last eat timestamp to not lose all hearts at once
    * No @params
    * No @return
    */
   void checkSnakeStarvationStatus() {
-    unsigned long currentTimestamp = millis();
-    if (currentTimestamp - lastSnakeEatTimestamp >= STARVING_TIME_INTERVAL) {
-      lastSnakeEatTimestamp = currentTimestamp;
+    if (gameClock - lastSnakeEatTimestamp >= STARVING_TIME_INTERVAL) {
+      lastSnakeEatTimestamp = gameClock;
       lostALife = true;
       snakeNumberOfLives--;
       if (settings->getIsSoundOn()) {
@@ -257,7 +503,7 @@ private:
   /**
    * Function that checks if the game has finished and marks the game as ended. Checks made:
    * - if the snake has hit a wall
-   * - if the snake has reached the max length
+   * - if the snake has reached the max length, filling the matrix
    * - if the snake starved to death - lost all his lives
    * No @params
    * No @return
@@ -265,16 +511,13 @@ private:
   void checkIfGameHasEnded() {
     // check if snake head hit a wall
     if (snakeHead.x < 0 || snakeHead.y < 0 || snakeHead.x >= MATRIX_SIZE || snakeHead.y >= MATRIX_SIZE) {
-      hasGameEnded = true;
-      inTransition = true;
+      endGame(GameEndCause::WALL);
     }
-    if (snakeLength > MATRIX_SIZE * MATRIX_SIZE) { // ended because user reached max length
-      hasGameEnded = true;
-      inTransition = true;
+    if (snakeLength >= MATRIX_SIZE * MATRIX_SIZE) { // ended because the snake fills the matrix, no food can spawn
+      endGame(GameEndCause::WON);
     }
     if (snakeNumberOfLives <= 0) { // ended because user lost all his lives
-      hasGameEnded = true;
-      inTransition = true;
+      endGame(GameEndCause::STARVATION);
     }
   }
 
@@ -288,11 +531,21 @@ private:
    */
   void checkSnakeAteHimself() {
     if (gameMatrix[snakeHead.x][snakeHead.y] > 0) {
-      hasGameEnded = true;
-      inTransition = true;
+      endGame(GameEndCause::SELF);
     }
   }
 
+  /**
+   * Function that marks the game as ended and keeps how it ended
+   * @param cause - how the game ended
+   * No @return
+   */
+  void endGame(const GameEndCause cause) {
+    hasGameEnded = true;
+    inTransition = true;
+    gameEndCause = cause;
+  }
+
   /**
    * Function that ask the game to generate a new food position
    * No @params
@@ -305,13 +558,15 @@ private:
   /**
    * Function that generates a new random food position.
    * The food won't be generated in a position where the snake is already present
+   * Expected to be called only while the matrix has a free position, a snake filling the matrix ends the game as won
    * No @params
    * No @return
    */
   void generateNewFood() {
     do {
-      food.x = random(MATRIX_SIZE);
-      food.y = random(MATRIX_SIZE);
+      randomState = getNextRandomState(randomState);
+      food.x = randomState % MATRIX_SIZE;
+      food.y = (randomState >> 8) % MATRIX_SIZE;
     } while (gameMatrix[food.x][food.y] > 0); // don't spawn food on snake's body
   }
 
@@ -334,6 +589,36 @@ private:
     lcMatrix->setLed(food.x, food.y, foodLightState);
   }
 
+  /**
+   * Function that display the ghost of the best game on the matrix with a fast blinking effect, to tell it apart from
+   * the live snake. Cells shared with the live snake stay lit and the food cell is left to the food's blinking
+   * Expected to be called in a loop
+   * No @params
+   * No @return
+   */
+  void displayGhost() {
+    static bool ghostLightState = true;
+    static unsigned long lastBlinkTime = 0;
+
+    if (isReplaying || isResumed || !ghost->getIsActive()) {
+      return;
+    }
+
+    unsigned long currentTimestamp = millis();
+    if (currentTimestamp - lastBlinkTime >= GHOST_BLINK_TIME) {
+      ghostLightState = !ghostLightState;
+      lastBlinkTime = currentTimestamp;
+    }
+
+    for (byte i = 0; i < GHOST_LENGTH; i++) {
+      const Point2D &segment = ghost->getBodySegment(i);
+      if (segment.x >= MATRIX_SIZE || segment.y >= MATRIX_SIZE || segment == food) {
+        continue;
+      }
+      lcMatrix->setLed(segment.x, segment.y, ghostLightState || gameMatrix[segment.x][segment.y] > 0);
+    }
+  }
+
   /**
    * Function that checks if the snake has eaten the food and updates the snake status accordingly (plays a sound,
    * increase snake's length, ask for new food, update last eat timestamp)
@@ -355,7 +640,7 @@ private:
         }
       }
       askForNewFood();
-      lastSnakeEatTimestamp = millis();
+      lastSnakeEatTimestamp = gameClock;
     }
   }
 
@@ -389,21 +674,100 @@ private:
   /**
    * Function that updates the snake on the new position he has to move to. The snake movement is considered natural,
    * the snake moves his head first then his body. Also checks if the snake has eaten himself or the food
+   * A live game ticks at deadlines snakeSpeed millis apart and records the applied direction, a replayed game ticks at
+   * full speed with the direction read from the replay log and ends when the log runs out
    * Expected to be called in a loop
    * No @params
    * No @return
    */
   void updateSnakePosition() {
-    static unsigned long lastPositionUpdateTimestamp = 0;
-    static unsigned long currentTimestamp = 0;
+    unsigned long currentTimestamp = millis();
+    if (isReplaying) {
+      if (!replay->hasNextTick()) {
+        hasGameEnded = true;
+        inTransition = true;
+        return;
+      }
+      snakeDirection = replay->getNextTick();
+      lastSnakeDirection = snakeDirection;
+    } else if (currentTimestamp - lastTickDeadline >= snakeSpeed) {
+      if (!isResumed) { // the replay of a resumed game would miss the ticks played before the snapshot
+        replay->recordTick(snakeDirection);
+      }
+      scheduleNextTick(currentTimestamp);
+    } else {
+      return;
+    }
+
+    playTick();
+  }
+
+  /**
+   * Function that moves the deadline of the tick played to the deadline of the next tick, one snakeSpeed later, so a
+   * late tick doesn't delay the ticks after it and the game keeps the configured speed. A tick late by a whole
+   * snakeSpeed or more skips the deadlines missed instead of playing them all at once
+   * @param currentTimestamp - the time the tick is played
+   * No @return
+   */
+  void scheduleNextTick(const unsigned long currentTimestamp) {
+    unsigned long lateness = currentTimestamp - lastTickDeadline - snakeSpeed;
+    unsigned int skippedTicks = lateness / snakeSpeed;
+    lastTickDeadline += (unsigned long) (skippedTicks + 1) * snakeSpeed;
+    diagnostics->recordTick(lateness, skippedTicks);
+  }
+
+  /**
+   * Function that advances the game by one tick of the game clock in the current snake direction. The tick depends
+   * only on the game state and the direction, so replaying the same directions with the same seed gives the same game
+   * No @params
+   * No @return
+   */
+  void playTick() {
+    gameClock += snakeSpeed;
+
+    if (!isReplaying && !isResumed) {
+      ghost->playTick(); // the ghost moves in lockstep with the live snake
+    }
+    updateSnakeHeadPosition();
+    checkSnakeAteFood();
+    updateSnakeWholeBody();
 
-    currentTimestamp = millis();
-    if (currentTimestamp - lastPositionUpdateTimestamp >= snakeSpeed) {
-      updateSnakeHeadPosition();
-      checkSnakeAteFood();
-      updateSnakeWholeBody();
+    checkSnakeStarvationStatus();
+    checkIfGameHasEnded();
+  }
+
+  /**
+   * Function that reports the replay of the game that just ended over Serial. A live game streams out its replay log
+   * to be loaded back later, a replayed game streams out its result to be checked against the original game, ending
+   * with 1 if the replay was truncated and the game ended at the last recorded tick instead. A resumed game has no
+   * replay to report
+   * No @params
+   * No @return
+   */
+  void reportReplay() {
+    if (isReplaying) {
+      Serial.print(F("REPLAY_RESULT "));
+      Serial.print(snakeLength);
+      Serial.print(' ');
+      Serial.print(getGameScoreValue(snakeLength));
+      Serial.print(' ');
+      Serial.print(gameClock / snakeSpeed);
+      Serial.print(' ');
+      Serial.println(replay->getIsTruncated());
+    } else if (!isResumed) {
+      replay->writeTo(Serial);
+    }
+  }
 
-      lastPositionUpdateTimestamp = currentTimestamp;
+  /**
+   * Function that adds the live game that just ended to the lifetime statistics, replayed games were already counted
+   * when they were played live
+   * No @params
+   * No @return
+   */
+  void recordStats() {
+    if (!isReplaying) {
+      stats->recordGame(gameEndCause, snakeLength - INITIAL_SNAKE_LENGTH, snakeLength, gameClock);
     }
   }
 
@@ -471,13 +835,13 @@ private:
     lcd->setCursorPosition(0, 1);
     lcd->animateOneSecondLCDLoadingWithDelay();
 
-    lcMatrix->displayThree();
+    lcMatrix->displayIcon(THREE_ICON);
     lcd->animateOneSecondLCDLoadingWithDelay();
 
-    lcMatrix->displayTwo();
+    lcMatrix->displayIcon(TWO_ICON);
     lcd->animateOneSecondLCDLoadingWithDelay();
 
-    lcMatrix->displayOne();
+    lcMatrix->displayIcon(ONE_ICON);
     lcd->animateOneSecondLCDLoadingWithDelay();
 
     inTransition = false;
@@ -485,8 +849,8 @@ private:
 
   /**
    * Function that plays the game over transition.
-   * - Plays a sound announcing the game over
-   * - Waits ~1s with delay to let the player see the state of the game when is over
+   * - Plays the game over song
+   * - Waits ~1s to let the player see the state of the game when is over, playing the song meanwhile
    * - Displays on the lcd the user score, the difficulty level played and a message depending if the users has beaten a
    * high score or not, which position he has in the high scores table and that he need to press the switch button to
    * return to the main menu
@@ -495,32 +859,39 @@ private:
    * No @return
    */
   void playGameEndedTransition() {
-    soundDevice->removeSound();
-    delay(100); // delay to not interfere with the theme's song
+    soundDevice->stopSong();
     if (settings->getIsSoundOn()) {
-      soundDevice->playSound(NOTE_C5, LOSING_TONE_DURATION);
+      soundDevice->startSong(TRACK_GAME_OVER);
+    }
+    lcMatrix->update(); // show the last state of the game
+    unsigned long transitionStartTimestamp = millis();
+    while (millis() - transitionStartTimestamp < 1000) { // wait to allow the user to look at the state of the game
+      soundDevice->update();
+      feedWatchdog();
     }
-    delay(1000); // delay to allow the user to look at the state of the game
 
     lcd->clear();
     int score = getGameScoreValue(snakeLength);
-    char scoreMessage[11];
-    sprintf(scoreMessage, "Score:%03d - D:%.1d", score, settings->getGameDifficulty());
     lcd->setCursorPosition(0, 0);
-    lcd->printMessage(scoreMessage);
+    lcd->printMessage(FLASH_STRING("Score:"));
+    lcd->printZeroPaddedNumber<3>(score);
+    lcd->printMessage(FLASH_STRING(" - D:"));
+    lcd->printZeroPaddedNumber<1>(gameDifficulty);
+    lcd->printCustomChar(getGameEndCauseChar(gameEndCause));
 
-    byte place = highscores->getNewHighscorePlace(score);
+    byte place = highscores->getNewHighscorePlace(gameDifficulty, score);
     if (place < NUMBER_OF_HIGHSCORES_SAVED) {
-      lcMatrix->displayHappyFace();
-      char *message = new char[MAX_GAME_END_MESSAGE_LENGTH];
-      sprintf(message, "Congrats! You are on place %.1d on highscores board :) - Press SW to save & continue",
-              place + 1);
-      lcd->printScrollingMessage(true, message, 0, 1, LCD_DISPLAY_WIDTH);
-      delete[] message;
+      static_assert(PLACE_MESSAGE_PREFIX_STRING_LENGTH + 1 + PLACE_MESSAGE_SUFFIX_STRING_LENGTH <
+                    MAX_GAME_END_MESSAGE_LENGTH, "the game end message doesn't fit its buffer");
+
+      lcMatrix->displayIcon(HAPPY_FACE_ICON);
+      char *messageEnd = copyUiString(gameEndMessage, PLACE_MESSAGE_PREFIX_STRING);
+      messageEnd = writeZeroPaddedNumber<1>(messageEnd, place + 1);
+      *copyUiString(messageEnd, PLACE_MESSAGE_SUFFIX_STRING) = '\0';
+      lcd->startScrolling(LCD_SECOND_ROW_SCROLL_REGION, gameEndMessage, 0, 1, LCD_DISPLAY_WIDTH);
     } else {
-      lcMatrix->displaySadFace();
-      lcd->printScrollingFlashStringMessage(true, F("You didn't beat any highscores :(  Press SW to continue"), 0, 1,
-                                            LCD_DISPLAY_WIDTH);
+      lcMatrix->displayIcon(SAD_FACE_ICON);
+      lcd->startScrolling(LCD_SECOND_ROW_SCROLL_REGION, NO_HIGHSCORE_MESSAGE_STRING, 0, 1, LCD_DISPLAY_WIDTH);
     }
 
     inTransition = false;
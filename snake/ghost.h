@@ -0,0 +1,200 @@
+/**
+ * File for the Ghost class
+ * The Ghost class is a singleton class that saves the input log of the best game in the EEPROM and plays it back as a
+ * blinking ghost snake alongside the live game.
+ * The ghost is saved as the log of the game's replay after a small header, the runs packed on 4 bits as in replay.h,
+ * so the whole log of a game that isn't truncated fits. The header keeps the difficulty level and the score of the
+ * game, so a game replaces the ghost only if it is better on both. The playback decodes the EEPROM incrementally,
+ * reading a byte only when the next 2 runs are needed, so the replay is never loaded whole in the RAM
+ */
+
+#ifndef GHOST_H
+#define GHOST_H
+
+#include <EEPROM.h>
+#include "config.h"
+#include "enums.h"
+#include "point2d.h"
+#include "replay.h"
+
+class Ghost {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Ghost *getInstance() {
+    static Ghost instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that checks if the ghost is still moving on the matrix
+   * No @params
+   * @return true if the ghost is playing, false otherwise
+   */
+  bool getIsActive() const {
+    return isActive;
+  }
+
+  /**
+   * Function that returns a segment of the ghost's body
+   * @param index - index of the segment, 0 being the head
+   * @return the position of the segment on the matrix
+   */
+  const Point2D &getBodySegment(const byte index) const {
+    return body[index];
+  }
+
+  /**
+   * Function that checks if a game is better than the game saved as the ghost: played on the same or a higher
+   * difficulty level and with a higher score. Any game is better than no ghost
+   * @param gameDifficulty - the difficulty level the game was played on
+   * @param score - the score of the game
+   * @return true if the game should replace the ghost, false otherwise
+   */
+  bool isBetterGame(const byte gameDifficulty, const unsigned int score) const {
+    if (EEPROM.read(GHOST_OFFSET_IN_STORAGE) != GHOST_STORAGE_MARKER) {
+      return true;
+    }
+
+    unsigned int ghostScore;
+    EEPROM.get(GHOST_OFFSET_IN_STORAGE + 2, ghostScore);
+    return gameDifficulty >= EEPROM.read(GHOST_OFFSET_IN_STORAGE + 1) && score > ghostScore;
+  }
+
+  /**
+   * Function that saves the log of a replay in the EEPROM as the ghost. Only the bytes that changed are written
+   * @param replay - the replay with the log of the game to be saved
+   * @param score - the score of the game
+   * No @return
+   */
+  void saveFromReplay(const Replay *replay, const unsigned int score) {
+    for (byte i = 0; i < replay->getLogSize(); i++) {
+      EEPROM.update(GHOST_OFFSET_IN_STORAGE + headerSize + i, replay->getLogByte(i));
+    }
+
+    EEPROM.update(GHOST_OFFSET_IN_STORAGE, GHOST_STORAGE_MARKER);
+    EEPROM.update(GHOST_OFFSET_IN_STORAGE + 1, replay->getGameDifficulty());
+    EEPROM.put(GHOST_OFFSET_IN_STORAGE + 2, score);
+    EEPROM.update(GHOST_OFFSET_IN_STORAGE + 4, byte(replay->getFirstDirection()));
+    EEPROM.put(GHOST_OFFSET_IN_STORAGE + 5, replay->getNumberOfRuns());
+  }
+
+  /**
+   * Function that starts the ghost from the initial snake position if a ghost is saved in the EEPROM
+   * No @params
+   * No @return
+   */
+  void startPlayback() {
+    isActive = EEPROM.read(GHOST_OFFSET_IN_STORAGE) == GHOST_STORAGE_MARKER;
+    direction = Direction(EEPROM.read(GHOST_OFFSET_IN_STORAGE + 4));
+    EEPROM.get(GHOST_OFFSET_IN_STORAGE + 5, runsLeft);
+    isFirstRun = true;
+
+    readAddress = GHOST_OFFSET_IN_STORAGE + headerSize;
+    isLowNibbleNext = false;
+    ticksLeftInRun = 0;
+
+    // same starting position as the live snake
+    for (byte i = 0; i < GHOST_LENGTH; i++) {
+      body[i] = {5, byte(GHOST_LENGTH - 1 - i)};
+    }
+  }
+
+  /**
+   * Function that moves the ghost one tick further, decoding the next run from the EEPROM when the current one ends.
+   * The ghost stops when the runs run out or it leaves the matrix
+   * No @params
+   * No @return
+   */
+  void playTick() {
+    if (!isActive) {
+      return;
+    }
+
+    if (ticksLeftInRun == 0) {
+      if (runsLeft == 0) {
+        isActive = false;
+        return;
+      }
+      byte runCode = readRunCode();
+      if (!isFirstRun) { // a new run turns from the run before it
+        direction = Replay::getTurnedDirection(direction, runCode);
+      }
+      isFirstRun = false;
+      ticksLeftInRun = (runCode & REPLAY_RUN_TICKS_MASK) + 1;
+      runsLeft--;
+    }
+    ticksLeftInRun--;
+
+    for (byte i = GHOST_LENGTH - 1; i > 0; i--) {
+      body[i] = body[i - 1];
+    }
+    switch (direction) {
+      case Direction::UP:
+        body[0].x--;
+        break;
+      case Direction::LEFT:
+        body[0].y--;
+        break;
+      case Direction::DOWN:
+        body[0].x++;
+        break;
+      case Direction::RIGHT:
+        body[0].y++;
+        break;
+      default:
+        break;
+    }
+
+    if (body[0].x >= MATRIX_SIZE || body[0].y >= MATRIX_SIZE) { // ghost hit a wall
+      isActive = false;
+    }
+  }
+
+private:
+  // marker + difficulty level + score + direction of the first run + number of runs
+  static const byte headerSize = 7;
+  static_assert(headerSize + REPLAY_LOG_SIZE <= GHOST_SIZE_IN_STORAGE, "the log of a replay fits in the ghost storage");
+
+  bool isActive = false;
+  Point2D body[GHOST_LENGTH];
+  Direction direction = Direction::RIGHT;
+  byte ticksLeftInRun = 0;
+  unsigned int runsLeft = 0;
+  bool isFirstRun = true;
+
+  // position of the next run read from the EEPROM
+  int readAddress = 0;
+  byte readByteValue = 0;
+  bool isLowNibbleNext = false;
+
+  /**
+   * Private constructor for the singleton class
+   */
+  Ghost() {}
+
+  Ghost(const Ghost &) = delete;
+
+  Ghost &operator=(const Ghost &) = delete;
+
+  /**
+   * Function that reads the next run from the EEPROM, a byte holds 2 runs, the first one on the high 4 bits
+   * No @params
+   * @return the run, on the 4 low bits
+   */
+  byte readRunCode() {
+    if (isLowNibbleNext) {
+      isLowNibbleNext = false;
+      return readByteValue & 0x0F;
+    }
+    readByteValue = EEPROM.read(readAddress++);
+    isLowNibbleNext = true;
+    return readByteValue >> 4;
+  }
+};
+
+#endif
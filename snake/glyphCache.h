@@ -0,0 +1,96 @@
+/**
+ * File for the GlyphCache class
+ * The GlyphCache class keeps track of the glyphs loaded in the 8 CGRAM slots of the LCD. A glyph gets a slot when it is
+ * first needed: a free slot or else the least recently used slot that isn't locked, the locked slots being the ones
+ * of the glyphs visible on the LCD, so a character on the glass never changes its shape. A glyph already loaded keeps
+ * its slot and doesn't need to be uploaded again
+ */
+
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include "config.h"
+
+#define NO_GLYPH 0xFF
+#define NO_GLYPH_SLOT 0xFF
+
+class GlyphCache {
+public:
+  /**
+   * Constructor that starts with all the slots free
+   */
+  GlyphCache() {
+    memset(slotGlyphs, NO_GLYPH, sizeof(slotGlyphs));
+  }
+
+  /**
+   * Function that finds the slot of a loaded glyph
+   * @param glyph - the index of the glyph in lcdGlyphs
+   * @return the slot of the glyph, NO_GLYPH_SLOT if the glyph isn't loaded
+   */
+  byte findSlot(const byte glyph) const {
+    for (byte slot = 0; slot < LCD_NUMBER_OF_CGRAM_SLOTS; slot++) {
+      if (slotGlyphs[slot] == glyph) {
+        return slot;
+      }
+    }
+    return NO_GLYPH_SLOT;
+  }
+
+  /**
+   * Function that returns the slot of a glyph, assigning it a slot if it isn't loaded. The glyph must be uploaded in
+   * the slot when a new slot was assigned
+   * @param glyph - the index of the glyph in lcdGlyphs
+   * @param lockedSlots - mask of the slots that can't be reassigned, bit i for slot i
+   * @param isUploadNeeded - set to true if the glyph got a new slot and needs to be uploaded, false otherwise
+   * @return the slot of the glyph, NO_GLYPH_SLOT if all the slots are locked
+   */
+  byte getSlot(const byte glyph, const byte lockedSlots, bool &isUploadNeeded) {
+    useClock++;
+    isUploadNeeded = false;
+
+    byte slot = findSlot(glyph);
+    if (slot == NO_GLYPH_SLOT) {
+      slot = findReplaceableSlot(lockedSlots);
+      if (slot == NO_GLYPH_SLOT) {
+        return NO_GLYPH_SLOT;
+      }
+      slotGlyphs[slot] = glyph;
+      isUploadNeeded = true;
+    }
+
+    slotLastUses[slot] = useClock;
+    return slot;
+  }
+
+private:
+  // glyph loaded in each slot and the time of its last use
+  byte slotGlyphs[LCD_NUMBER_OF_CGRAM_SLOTS];
+  unsigned int slotLastUses[LCD_NUMBER_OF_CGRAM_SLOTS] = {0};
+  unsigned int useClock = 0;
+
+  /**
+   * Function that picks the slot for a new glyph: a free slot or else the least recently used unlocked slot
+   * @param lockedSlots - mask of the slots that can't be reassigned
+   * @return the slot picked, NO_GLYPH_SLOT if all the slots are locked
+   */
+  byte findReplaceableSlot(const byte lockedSlots) const {
+    byte replaceableSlot = NO_GLYPH_SLOT;
+    for (byte slot = 0; slot < LCD_NUMBER_OF_CGRAM_SLOTS; slot++) {
+      if (lockedSlots & (1 << slot)) {
+        continue;
+      }
+      if (slotGlyphs[slot] == NO_GLYPH) {
+        return slot;
+      }
+      // compare the ages of the uses, so the order survives the use clock overflow
+      if (replaceableSlot == NO_GLYPH_SLOT ||
+          useClock - slotLastUses[slot] > useClock - slotLastUses[replaceableSlot]) {
+        replaceableSlot = slot;
+      }
+    }
+    return replaceableSlot;
+  }
+};
+
+#endif
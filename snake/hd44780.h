@@ -0,0 +1,165 @@
+/**
+ * File for the HD44780 class
+ * The HD44780 class is a driver for a HD44780 LCD in 4-bit mode, specialized at compile time on its pins. The port
+ * registers and bit masks of the pins are resolved at compile time, so setting a pin is a single instruction instead
+ * of a digitalWrite() with its pin-map lookups, and when the data pins share a port the data nibble goes out with a
+ * single port write. The driver doesn't wait a fixed time after each byte like LiquidCrystal, it only waits what is
+ * left of the LCD execution time before sending the next byte.
+ */
+
+#ifndef HD44780_H
+#define HD44780_H
+
+#include "config.h"
+#include "pins.h"
+
+// HD44780 commands and execution times
+#define HD44780_CLEAR_COMMAND 0x01
+#define HD44780_ENTRY_MODE_INCREMENT_COMMAND 0x06
+#define HD44780_FUNCTION_SET_4_BIT_2_LINES_COMMAND 0x28
+#define HD44780_SET_CGRAM_ADDRESS_COMMAND 0x40
+#define HD44780_COMMAND_EXECUTION_TIME 37
+#define HD44780_CLEAR_EXECUTION_TIME 1520
+
+template<byte rsPin, byte enablePin, byte d4Pin, byte d5Pin, byte d6Pin, byte d7Pin>
+class HD44780 {
+public:
+  /**
+   * Function that initializes the LCD in 4-bit mode with 2 lines, display on, cursor off and clears it
+   * Blocking, waits for the LCD power up
+   * No @params
+   * No @return
+   */
+  void begin() {
+    pinMode(rsPin, OUTPUT);
+    pinMode(enablePin, OUTPUT);
+    pinMode(d4Pin, OUTPUT);
+    pinMode(d5Pin, OUTPUT);
+    pinMode(d6Pin, OUTPUT);
+    pinMode(d7Pin, OUTPUT);
+
+    delay(50); // wait for the LCD power up
+    getPinPortRegister(rsPin) &= ~rsMask;
+    getPinPortRegister(enablePin) &= ~enableMask;
+
+    // initialization by instruction, to enter 4-bit mode from any state
+    sendNibble(0x03);
+    delayMicroseconds(4500);
+    sendNibble(0x03);
+    delayMicroseconds(4500);
+    sendNibble(0x03);
+    delayMicroseconds(150);
+    sendNibble(0x02);
+    delayMicroseconds(HD44780_COMMAND_EXECUTION_TIME);
+
+    command(HD44780_FUNCTION_SET_4_BIT_2_LINES_COMMAND);
+    command(LCD_DISPLAY_ON_CURSOR_OFF_COMMAND);
+    command(HD44780_ENTRY_MODE_INCREMENT_COMMAND);
+    clear();
+  }
+
+  /**
+   * Function that clears the LCD and moves the cursor at the start
+   * No @params
+   * No @return
+   */
+  void clear() {
+    command(HD44780_CLEAR_COMMAND);
+  }
+
+  /**
+   * Function that saves a custom character in the LCD's CGRAM. Leaves the LCD writing in the CGRAM, a cursor move or a
+   * clear is needed before writing characters
+   * @param slot - the custom character slot, 0 to 7
+   * @param charEncoding - the 8 rows of the custom character
+   * No @return
+   */
+  void createChar(const byte slot, const byte charEncoding[]) {
+    command(HD44780_SET_CGRAM_ADDRESS_COMMAND | ((slot & 0x07) << 3));
+    for (byte i = 0; i < 8; i++) {
+      write(charEncoding[i]);
+    }
+  }
+
+  /**
+   * Function that sends a command byte to the LCD
+   * @param value - the command
+   * No @return
+   */
+  void command(const byte value) {
+    send(value, false);
+    executionTime = value == HD44780_CLEAR_COMMAND ? HD44780_CLEAR_EXECUTION_TIME : HD44780_COMMAND_EXECUTION_TIME;
+  }
+
+  /**
+   * Function that sends a data byte to the LCD, a character at the cursor or a CGRAM row
+   * @param value - the data
+   * No @return
+   */
+  void write(const byte value) {
+    send(value, true);
+    executionTime = HD44780_COMMAND_EXECUTION_TIME;
+  }
+
+private:
+  static constexpr byte rsMask = getPinBitMask(rsPin);
+  static constexpr byte enableMask = getPinBitMask(enablePin);
+  static constexpr bool areDataPinsOnOnePort = getPinPortIndex(d4Pin) == getPinPortIndex(d5Pin) &&
+                                               getPinPortIndex(d4Pin) == getPinPortIndex(d6Pin) &&
+                                               getPinPortIndex(d4Pin) == getPinPortIndex(d7Pin);
+  static constexpr byte dataMask = getPinBitMask(d4Pin) | getPinBitMask(d5Pin) | getPinBitMask(d6Pin) |
+                                   getPinBitMask(d7Pin);
+
+  unsigned long lastSendTimestamp = 0;
+  unsigned int executionTime = 0;
+
+  /**
+   * Function that sends a byte to the LCD as two nibbles, after waiting what is left of the execution time of the
+   * previous byte
+   * @param value - the byte to send
+   * @param isData - true to send the byte as data, false to send it as a command
+   * No @return
+   */
+  void send(const byte value, const bool isData) {
+    while (micros() - lastSendTimestamp < executionTime) {}
+
+    if (isData) {
+      getPinPortRegister(rsPin) |= rsMask;
+    } else {
+      getPinPortRegister(rsPin) &= ~rsMask;
+    }
+    sendNibble(value >> 4);
+    sendNibble(value & 0x0F);
+
+    lastSendTimestamp = micros();
+  }
+
+  /**
+   * Function that puts a nibble on the data pins and latches it with a pulse on the enable pin. The enable pulse is
+   * kept high for 8 cycles, 500ns at 16MHz, just above the 450ns the LCD needs
+   * @param nibble - the nibble to send, on the 4 low bits
+   * No @return
+   */
+  void sendNibble(const byte nibble) {
+    if (areDataPinsOnOnePort) {
+      byte dataBits = ((nibble & 0x01) ? getPinBitMask(d4Pin) : 0) | ((nibble & 0x02) ? getPinBitMask(d5Pin) : 0) |
+                      ((nibble & 0x04) ? getPinBitMask(d6Pin) : 0) | ((nibble & 0x08) ? getPinBitMask(d7Pin) : 0);
+      volatile byte &dataPort = getPinPortRegister(d4Pin);
+      dataPort = (dataPort & ~dataMask) | dataBits;
+    } else {
+      writePinFast(d4Pin, nibble & 0x01);
+      writePinFast(d5Pin, nibble & 0x02);
+      writePinFast(d6Pin, nibble & 0x04);
+      writePinFast(d7Pin, nibble & 0x08);
+    }
+
+    getPinPortRegister(enablePin) |= enableMask;
+    __asm__ __volatile__("nop\n\tnop\n\tnop\n\tnop\n\tnop\n\tnop\n\tnop\n\tnop\n\t");
+    getPinPortRegister(enablePin) &= ~enableMask;
+  }
+};
+
+// driver of the game's LCD
+typedef HD44780<LCD_RS, LCD_ENABLE, LCD_D4, LCD_D5, LCD_D6, LCD_D7> LcdDriver;
+
+#endif
@@ -1,64 +1,83 @@
 /**
- * File for the highscores board class
- * The Highscores class is a singleton class that allows access to the highscores board, and allow methods for updating
- * the board and save it in storage
+ * File for the highscores boards class
+ * The Highscores class is a singleton class that allows access to the highscores boards, one board for each difficulty
+ * level, and allow methods for updating the boards and save them in storage.
+ * A highscore is bit-packed in HIGHSCORE_RECORD_SIZE bytes: the score on 10 bits, the 6 letters of the player name on
+ * 6 bits each and the difficulty level on 2 bits. Only the board of one difficulty level is kept in memory, a board is
+ * loaded from the storage when a highscore of another difficulty level is needed
  */
 
 #ifndef HIGHSCORES_H
 #define HIGHSCORES_H
 
-#include <EEPROM.h>
-#include "settings.h"
+#include "storage.h"
+
+// bits of a packed highscore
+#define HIGHSCORE_SCORE_BITS 10
+#define HIGHSCORE_LETTER_BITS 6
+#define HIGHSCORE_DIFFICULTY_BITS 2
+#define HIGHSCORE_RECORD_SIZE 6
+#define MAX_HIGHSCORE_SCORE ((1 << HIGHSCORE_SCORE_BITS) - 1)
+
+static_assert(HIGHSCORE_SCORE_BITS + MAX_PLAYER_NAME_LENGTH * HIGHSCORE_LETTER_BITS + HIGHSCORE_DIFFICULTY_BITS ==
+              HIGHSCORE_RECORD_SIZE * 8, "the packed highscore fields don't fill its bytes");
+static_assert(MAX_DIFFICULTY_LEVEL - MIN_DIFFICULTY_LEVEL < (1 << HIGHSCORE_DIFFICULTY_BITS),
+              "the difficulty levels don't fit in the packed highscore");
 
 class Highscores {
 public:
   /**
-   * struct for highscore entry for easier access to the data, and passing it around
-   * it allows for easier access to the data in the EEPROM
-   * also defined an operator for assigning the struct variable to another struct variable
+   * struct for a highscore unpacked from a board, for easier access to the data, and passing it around
    */
-  struct HighscoresData {
-    int score;
+  struct HighscoreEntry {
+    unsigned int score;
     char playerName[MAX_PLAYER_NAME_LENGTH + 1];
-
-    HighscoresData &operator=(const HighscoresData &other) {
-      score = other.score;
-      strcpy(playerName, other.playerName);
-    }
   };
 
-  // define special type to return the array of highscores
-  typedef HighscoresData HighscoresDataArray[NUMBER_OF_HIGHSCORES_SAVED];
-
   /**
    * Static method to get a pointer to the instance of the class
    * No @params
    * @return pointer to the instance of the class
    */
   static Highscores *getInstance() {
-    static Highscores *instance = new Highscores();
+    static Highscores instance;
 
-    return instance;
+    return &instance;
   }
 
   /**
-   * Getter method to get the highscores data array
-   * No @params
-   * @return a const reference to the highscores data array
+   * Function that returns a highscore of a difficulty level's board
+   * @param difficulty - the difficulty level of the board
+   * @param place - the place of the highscore on the board, starting from 0
+   * @return the highscore unpacked
    */
-  const HighscoresDataArray &getHighscoresDataArray() const {
-    return highscoresData;
+  HighscoreEntry getHighscore(const byte difficulty, const byte place) {
+    loadBoard(difficulty);
+
+    HighscoreEntry entry;
+    BitCursor cursor = {board[place], 0};
+    entry.score = readBits(cursor, HIGHSCORE_SCORE_BITS);
+    for (byte i = 0; i < MAX_PLAYER_NAME_LENGTH; i++) {
+      entry.playerName[i] = decodeLetter(readBits(cursor, HIGHSCORE_LETTER_BITS));
+    }
+    entry.playerName[MAX_PLAYER_NAME_LENGTH] = '\0';
+    return entry;
   }
 
   /**
-   * Function that computes the place a score would be in the highscores board
-   * @param score the score to check
+   * Function that computes the place a score would be in a difficulty level's highscores board
+   * @param difficulty - the difficulty level of the board
+   * @param score - the score to check
    * @return the place the score would be in the highscores board
    */
-  byte getNewHighscorePlace(int score) {
+  byte getNewHighscorePlace(const byte difficulty, unsigned int score) {
+    loadBoard(difficulty);
+    score = min(score, (unsigned int) MAX_HIGHSCORE_SCORE);
+
     byte place = 0;
     while (place < NUMBER_OF_HIGHSCORES_SAVED) {
-      if (score > highscoresData[place].score) {
+      BitCursor cursor = {board[place], 0};
+      if (score > readBits(cursor, HIGHSCORE_SCORE_BITS)) {
         break;
       }
       place++;
@@ -67,82 +86,193 @@ public:
   }
 
   /**
-   * Function that updates the highscores board with a new score and player name.
+   * Function that updates a difficulty level's highscores board with a new score and player name.
    * If the score is not high enough to be in the highscores board, it will not be added
-   * The function will also save the new highscores board in the EEPROM
+   * The function will also save the new highscores board in the storage, in the slot after the newest one, so the
+   * bytes written are the ones that differ from the board saved in that slot, older than the current one
+   * @param difficulty - the difficulty level the score was achieved on
    * @param score
    * @param playerName
    * No @return
    */
-  void updateHighscores(const int score, const char *playerName) {
+  void updateHighscores(const byte difficulty, const unsigned int score, const char *playerName) {
     // find the new index where the score should be inserted
-    byte placeIndex = getNewHighscorePlace(score);
+    byte placeIndex = getNewHighscorePlace(difficulty, score);
     if (placeIndex >= NUMBER_OF_HIGHSCORES_SAVED) {
       return; // didn't achieve a better score to be saved on the board
     }
 
     // shift the highscores down one position to make room for the new score
-    for (byte i = NUMBER_OF_HIGHSCORES_SAVED - 1; i > placeIndex; i--) {
-      highscoresData[i] = highscoresData[i - 1];
-    }
-
-    // insert the new highscore and the player name in the correct position
-    highscoresData[placeIndex].score = score;
-    strcpy(highscoresData[placeIndex].playerName, playerName);
+    memmove(board[placeIndex + 1], board[placeIndex],
+            (NUMBER_OF_HIGHSCORES_SAVED - 1 - placeIndex) * HIGHSCORE_RECORD_SIZE);
+    packHighscore(board[placeIndex], min(score, (unsigned int) MAX_HIGHSCORE_SCORE), playerName, difficulty);
 
     saveInStorage();
   }
 
   /**
-   * Function that resets the highscores board to the default values.
+   * Function that resets the highscores boards of all difficulty levels to the default values.
    * The default values are all scores of 0 achieved by "NO ONE"
-   * The function will also save the new highscores board in the EEPROM
+   * The function will also save the new highscores boards in the storage
    * No @params
    * No @return
    */
   void resetHighscores() {
-    for (byte i = 0; i < NUMBER_OF_HIGHSCORES_SAVED; i++) {
-      highscoresData[i].score = 0;
-      strcpy(highscoresData[i].playerName, "NO ONE");
+    for (byte difficulty = MIN_DIFFICULTY_LEVEL; difficulty <= MAX_DIFFICULTY_LEVEL; difficulty++) {
+      setDefaults(difficulty);
+      saveInStorage();
     }
-    saveInStorage();
   }
 
+private:
   /**
-   * Function that loads the highscores board from the EEPROM
-   * The highscores are saved in EEPROM after the settings data
-   * No @params
+   * struct for the position of a bit in a packed highscore
+   */
+  struct BitCursor {
+    byte *bytes;
+    byte bitIndex;
+  };
+
+  // the board of the loaded difficulty level, the highscores are packed
+  byte board[NUMBER_OF_HIGHSCORES_SAVED][HIGHSCORE_RECORD_SIZE];
+  byte loadedDifficulty = 0; // no board is loaded
+
+  /**
+   * Private constructor for the singleton class
+   * The boards are loaded from the storage when they are first needed
+   */
+  Highscores() {}
+
+  Highscores(const Highscores &) = delete;
+
+  Highscores &operator=(const Highscores &) = delete;
+
+  /**
+   * Function that loads the highscores board of a difficulty level from the storage if it isn't loaded already, the
+   * default board is used if no valid board is saved
+   * @param difficulty - the difficulty level of the board
    * No @return
    */
-  void loadFromStorage() {
-    EEPROM.get(Settings::sizeOfSettingsData(), highscoresData);
+  void loadBoard(const byte difficulty) {
+    if (difficulty == loadedDifficulty) {
+      return;
+    }
+
+    loadedDifficulty = difficulty;
+    if (!Storage::getInstance()->load(getBoardRecord(difficulty), board)) {
+      setDefaults(difficulty);
+    }
   }
 
   /**
-   * Function that saves the highscores board in the EEPROM
-   * The highscores will be saved in EEPROM after the settings data
+   * Function that saves the loaded highscores board in the storage
    * No @params
    * No @return
    */
   void saveInStorage() {
-    EEPROM.put(Settings::sizeOfSettingsData(), highscoresData);
+    Storage::getInstance()->save(getBoardRecord(loadedDifficulty), board);
   }
 
-private:
-  // array of highscores data board
-  HighscoresData highscoresData[NUMBER_OF_HIGHSCORES_SAVED];
+  /**
+   * Function that sets the default highscores board of a difficulty level as the loaded board, all scores of 0
+   * achieved by "NO ONE"
+   * @param difficulty - the difficulty level of the board
+   * No @return
+   */
+  void setDefaults(const byte difficulty) {
+    loadedDifficulty = difficulty;
+    for (byte i = 0; i < NUMBER_OF_HIGHSCORES_SAVED; i++) {
+      packHighscore(board[i], 0, "NO ONE", difficulty);
+    }
+  }
+
+  static StorageRecord getBoardRecord(const byte difficulty) {
+    return StorageRecord((byte) StorageRecord::FIRST_HIGHSCORES_BOARD + difficulty - MIN_DIFFICULTY_LEVEL);
+  }
 
   /**
-   * Private constructor for the singleton class
-   * The constructor will load the highscores board from the storage
+   * Function that packs a highscore in HIGHSCORE_RECORD_SIZE bytes
+   * @param bytes - the bytes of the packed highscore
+   * @param score - the score, at most MAX_HIGHSCORE_SCORE
+   * @param playerName - the player name, padded with spaces if shorter than MAX_PLAYER_NAME_LENGTH
+   * @param difficulty - the difficulty level the score was achieved on
+   * No @return
    */
-  Highscores() {
-    loadFromStorage();
+  static void packHighscore(byte *bytes, const unsigned int score, const char *playerName, const byte difficulty) {
+    BitCursor cursor = {bytes, 0};
+    writeBits(cursor, score, HIGHSCORE_SCORE_BITS);
+    bool isNameEnded = false;
+    for (byte i = 0; i < MAX_PLAYER_NAME_LENGTH; i++) {
+      isNameEnded = isNameEnded || playerName[i] == '\0';
+      writeBits(cursor, encodeLetter(isNameEnded ? ' ' : playerName[i]), HIGHSCORE_LETTER_BITS);
+    }
+    writeBits(cursor, difficulty - MIN_DIFFICULTY_LEVEL, HIGHSCORE_DIFFICULTY_BITS);
   }
 
-  Highscores(const Highscores &) = delete;
+  /**
+   * Function that reads bits from a packed highscore, most significant bit first
+   * @param cursor - the position of the first bit, moved after the bits read
+   * @param numberOfBits - the number of bits to read
+   * @return the bits read
+   */
+  static unsigned int readBits(BitCursor &cursor, const byte numberOfBits) {
+    unsigned int value = 0;
+    for (byte i = 0; i < numberOfBits; i++, cursor.bitIndex++) {
+      value = (value << 1) | ((cursor.bytes[cursor.bitIndex >> 3] >> (7 - (cursor.bitIndex & 0x07))) & 0x01);
+    }
+    return value;
+  }
 
-  Highscores &operator=(const Highscores &) = delete;
+  /**
+   * Function that writes bits in a packed highscore, most significant bit first
+   * @param cursor - the position of the first bit, moved after the bits written
+   * @param value - the bits to write
+   * @param numberOfBits - the number of bits to write
+   * No @return
+   */
+  static void writeBits(BitCursor &cursor, const unsigned int value, const byte numberOfBits) {
+    for (byte i = numberOfBits; i > 0; i--, cursor.bitIndex++) {
+      byte mask = 0x80 >> (cursor.bitIndex & 0x07);
+      if ((value >> (i - 1)) & 0x01) {
+        cursor.bytes[cursor.bitIndex >> 3] |= mask;
+      } else {
+        cursor.bytes[cursor.bitIndex >> 3] &= ~mask;
+      }
+    }
+  }
+
+  /**
+   * Function that encodes a letter of the player name in the 6-bit alphabet of the name menu: space, digits, uppercase
+   * and lowercase letters
+   * @param letter - the letter
+   * @return the letter's code, a space for letters out of the alphabet
+   */
+  static byte encodeLetter(const char letter) {
+    if (letter >= '0' && letter <= '9') {
+      return 1 + letter - '0';
+    } else if (letter >= 'A' && letter <= 'Z') {
+      return 11 + letter - 'A';
+    } else if (letter >= 'a' && letter <= 'z') {
+      return 37 + letter - 'a';
+    }
+    return 0;
+  }
+
+  /**
+   * Function that decodes a letter of the player name from the 6-bit alphabet of the name menu
+   * @param code - the letter's code
+   * @return the letter
+   */
+  static char decodeLetter(const byte code) {
+    if (code >= 37) {
+      return 'a' + code - 37;
+    } else if (code >= 11) {
+      return 'A' + code - 11;
+    } else if (code >= 1) {
+      return '0' + code - 1;
+    }
+    return ' ';
+  }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -17,9 +17,9 @@ public:
    * @return pointer to the instance of the class
    */
   static Joystick *getInstance() {
-    static Joystick *instance = new Joystick();
+    static Joystick instance;
 
-    return instance;
+    return &instance;
   }
 
   /**
@@ -33,9 +33,11 @@ public:
     int readValue = analogRead(JOYSTICK_X_PIN);
     if (readValue >= JOYSTICK_MAX_THRESHOLD) {
       lastReadState = XDirection::RIGHT;
+      lastActivityTimestamp = millis();
       return XDirection::RIGHT;
     } else if (readValue <= JOYSTICK_MIN_THRESHOLD) {
       lastReadState = XDirection::LEFT;
+      lastActivityTimestamp = millis();
       return XDirection::LEFT;
     } else if (readValue >= JOYSTICK_MIN_MIDDLE_THRESHOLD && readValue <= JOYSTICK_MAX_MIDDLE_THRESHOLD) {
       lastReadState = XDirection::MIDDLE;
@@ -56,9 +58,11 @@ public:
     int readValue = analogRead(JOYSTICK_Y_PIN);
     if (readValue >= JOYSTICK_MAX_THRESHOLD) {
       lastReadState = YDirection::DOWN;
+      lastActivityTimestamp = millis();
       return YDirection::DOWN;
     } else if (readValue <= JOYSTICK_MIN_THRESHOLD) {
       lastReadState = YDirection::UP;
+      lastActivityTimestamp = millis();
       return YDirection::UP;
     } else if (readValue >= JOYSTICK_MIN_MIDDLE_THRESHOLD && readValue <= JOYSTICK_MAX_MIDDLE_THRESHOLD) {
       lastReadState = YDirection::MIDDLE;
@@ -127,9 +131,29 @@ public:
     return switchState == LOW;
   }
 
+  /**
+   * Function that checks if the joystick switch is held down, with debounce
+   * No @params
+   * @return true if the joystick switch is held down, false otherwise
+   */
+  bool isSwitchHeld() {
+    updateSwitchPressed();
+    return switchState == LOW;
+  }
+
+  /**
+   * Getter for the last time the joystick was moved or its switch was pressed, as seen by the readings made
+   * No @params
+   * @return the timestamp in millis
+   */
+  unsigned long getLastActivityTimestamp() const {
+    return lastActivityTimestamp;
+  }
+
 private:
   bool joyMovedOnXAxis, joyMovedOnYAxis;
   byte switchState;
+  unsigned long lastActivityTimestamp = 0;
 
   /**
    * Private constructor for the singleton class
@@ -161,6 +185,9 @@ private:
     static byte lastSwitchReading = HIGH;
 
     switchReading = digitalRead(JOYSTICK_SW_PIN);
+    if (switchReading == LOW) {
+      lastActivityTimestamp = millis();
+    }
     if (switchReading != lastSwitchReading) {
       lastSwitchReadingTime = millis();
     }
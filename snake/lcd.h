@@ -1,16 +1,28 @@
 /**
  * File for the LCD class
  * The LCD class is a singleton class that allows safe custom printing methods on the lcd using cstrings either from
- * RAM or the Flash memory. Also allow methods to interact with the LiquidCrystal library object proprieties, since
- * the library object is hidden from the user, to avoid direct printing
+ * RAM or the Flash memory. Also allow methods to interact with the LCD driver object proprieties, since the driver
+ * object is hidden from the user, to avoid direct printing
+ * The printing methods don't write on the LCD directly, they write in a 16x2 screen buffer. A call to commit() compares
+ * the screen buffer with a shadow buffer of the characters currently on the glass and sends only the characters that
+ * changed, so redrawing a whole screen after clear() costs only the bus time of its differences, without flicker.
+ * The bytes to be sent are not written on the bus right away, commit() puts them in a ring buffer queue that is
+ * drained a few bytes at a time by pump(), so printing never stalls the main loop for a whole string.
+ * The custom characters are printed with their glyph codes from lcdCharacters.h, commit() loads the glyphs in the
+ * CGRAM slots on demand through a GlyphCache, uploading a glyph only when it gets a new slot
  */
 
 #ifndef LCD_H
 #define LCD_H
 
-#include <LiquidCrystal.h>
-#include "lcdCharacters.h"
 #include "config.h"
+#include "flashString.h"
+#include "format.h"
+#include "hd44780.h"
+#include "glyphCache.h"
+#include "lcdCharacters.h"
+#include "scroller.h"
+#include "uiStringReader.h"
 #include "utils.h"
 
 class LCD {
@@ -21,18 +33,49 @@ public:
    * @return pointer to the instance of the class
    */
   static LCD *getInstance() {
-    static LCD *instance = new LCD();
+    static LCD instance;
 
-    return instance;
+    return &instance;
   }
 
   /**
-   * Function that sets the brightness of the LCD backlight
+   * Function that sets the brightness of the LCD backlight, a dimmed backlight gets the brightness when undimmed
    * @param value - the value to set the brightness to
    * No @return
    */
   void setBrightness(const int value) {
-    analogWrite(LCD_INTENSITY_PIN, value);
+    brightness = value;
+    if (!isDimmed) {
+      analogWrite(LCD_INTENSITY_PIN, brightness);
+    }
+  }
+
+  /**
+   * Function that dims the LCD backlight to LCD_DIMMED_BRIGHTNESS_VALUE or restores its brightness
+   * @param newIsDimmed - true to dim the backlight, false to restore it
+   * No @return
+   */
+  void setIsDimmed(const bool newIsDimmed) {
+    isDimmed = newIsDimmed;
+    analogWrite(LCD_INTENSITY_PIN, isDimmed ? LCD_DIMMED_BRIGHTNESS_VALUE : brightness);
+  }
+
+  /**
+   * Function that checks if everything printed was sent to the LCD
+   * No @params
+   * @return true if no byte is waiting in the queue, false otherwise
+   */
+  bool getIsQueueEmpty() const {
+    return queueLength == 0;
+  }
+
+  /**
+   * Getter for the number of bytes sent to the LCD since boot, commands and characters
+   * No @params
+   * @return the number of bytes
+   */
+  unsigned long getBytesSent() const {
+    return bytesSent;
   }
 
   /**
@@ -45,12 +88,17 @@ public:
   }
 
   /**
-   * Function that clears all the content on the LCD
+   * Function that clears all the content on the LCD, stopping the scrolling regions
    * No @params
    * No @return
    */
   void clear() {
-    lcd.clear();
+    for (byte i = 0; i < LCD_NUMBER_OF_SCROLL_REGIONS; i++) {
+      scrollers[i].stop();
+    }
+    memset(screenBuffer, ' ', sizeof(screenBuffer));
+    cursorCol = 0;
+    cursorRow = 0;
   }
 
   /**
@@ -59,7 +107,9 @@ public:
    * No @return
    */
   void showCursor() {
-    lcd.cursor();
+    isCursorShown = true;
+    isCursorCommandPending = true;
+    enqueueCursorCommand();
   }
 
   /**
@@ -68,7 +118,9 @@ public:
    * No @return
    */
   void hideCursor() {
-    lcd.noCursor();
+    isCursorShown = false;
+    isCursorCommandPending = true;
+    enqueueCursorCommand();
   }
 
   /**
@@ -78,7 +130,123 @@ public:
    * No @return
    */
   void setCursorPosition(const byte &col, const byte &row) {
-    lcd.setCursor(col, row);
+    cursorCol = col;
+    cursorRow = row;
+  }
+
+  /**
+   * Function that queues to be sent to the LCD the characters of the screen buffer that differ from the ones on the
+   * glass. The cursor is moved only when the next changed character is not the one following the last character
+   * queued. A glyph is uploaded in a CGRAM slot before its first character if it isn't loaded, the slots of the glyphs
+   * on the glass or in the screen buffer are never reassigned. A glyph with no slot left is shown as
+   * LCD_MISSING_GLYPH_CHAR until a slot gets free. When the cursor is shown it's placed back at its position after the
+   * update. If the queue fills up the remaining characters, and a cursor command that didn't fit, are queued by the
+   * next commit
+   * Needs to be called after printing for the changes to be seen
+   * No @params
+   * No @return
+   */
+  void commit() {
+    if (isCursorCommandPending) {
+      enqueueCursorCommand();
+    }
+
+    byte lockedSlots = 0;
+    bool isLockedSlotsKnown = false; // the visible slots are found only when a glyph needs a new slot
+
+    for (byte row = 0; row < LCD_DISPLAY_HEIGHT; row++) {
+      for (byte col = 0; col < LCD_DISPLAY_WIDTH; col++) {
+        byte c = screenBuffer[row][col];
+        if (c == glassBuffer[row][col]) {
+          continue;
+        }
+        bool isGlyph = isGlyphCode(c);
+        if (queueLength + 2 + (isGlyph ? 9 : 0) > LCD_QUEUE_SIZE) { // no room for a glyph, a cursor move and a char
+          return;
+        }
+
+        byte lcdChar = c;
+        if (isGlyph) {
+          if (!isLockedSlotsKnown && glyphCache.findSlot(c - LCD_FIRST_GLYPH_CODE) == NO_GLYPH_SLOT) {
+            lockedSlots = getVisibleGlyphSlots();
+            isLockedSlotsKnown = true;
+          }
+          bool isUploadNeeded;
+          byte slot = glyphCache.getSlot(c - LCD_FIRST_GLYPH_CODE, lockedSlots, isUploadNeeded);
+          if (slot == NO_GLYPH_SLOT) { // more glyphs visible than slots, retried by the next commits
+            if (glassBuffer[row][col] == LCD_MISSING_GLYPH_CHAR) {
+              continue;
+            }
+            lcdChar = LCD_MISSING_GLYPH_CHAR;
+          } else {
+            if (isUploadNeeded) {
+              enqueueGlyphUpload(c - LCD_FIRST_GLYPH_CODE, slot);
+            }
+            lockedSlots |= 1 << slot;
+            lcdChar = slot;
+          }
+        }
+
+        if (hardwareCursorCol != col || hardwareCursorRow != row) {
+          enqueue(getSetCursorCommand(col, row), true);
+          hardwareCursorRow = row;
+        }
+        enqueue(lcdChar, false);
+        glassBuffer[row][col] = lcdChar == LCD_MISSING_GLYPH_CHAR ? lcdChar : c;
+        hardwareCursorCol = col + 1;
+      }
+    }
+
+    if (isCursorShown && (hardwareCursorCol != cursorCol || hardwareCursorRow != cursorRow) &&
+        enqueue(getSetCursorCommand(cursorCol, cursorRow), true)) {
+      hardwareCursorCol = cursorCol;
+      hardwareCursorRow = cursorRow;
+    }
+  }
+
+  /**
+   * Function that sends to the LCD at most LCD_QUEUE_BYTES_PER_PUMP bytes from the queue
+   * Needs to be called in a loop
+   * No @params
+   * No @return
+   */
+  void pump() {
+    for (byte i = 0; i < LCD_QUEUE_BYTES_PER_PUMP && queueLength > 0; i++) {
+      sendQueueHead();
+    }
+  }
+
+  /**
+   * Function that moves the scrolling regions, queues the changes and updates the LCD with a part of the queue
+   * Needs to be called in a loop
+   * No @params
+   * No @return
+   */
+  void update() {
+    for (byte i = 0; i < LCD_NUMBER_OF_SCROLL_REGIONS; i++) {
+      if (scrollers[i].step()) {
+        printScrollerWindow(scrollers[i]);
+      }
+    }
+    commit();
+    pump();
+  }
+
+  /**
+   * Blocking function that queues the changes and sends the whole queue to the LCD
+   * It stops when a commit queues nothing: the characters left that differ from the glass are glyphs with no slot,
+   * already shown as LCD_MISSING_GLYPH_CHAR, retried by the next updates
+   * No @params
+   * No @return
+   */
+  void flush() {
+    commit();
+    while (queueLength > 0) {
+      while (queueLength > 0) {
+        sendQueueHead();
+      }
+      commit();
+    }
   }
 
   /**
@@ -88,9 +256,12 @@ public:
    */
   void animateOneSecondLCDLoadingWithDelay() {
     for (byte i = 0; i < 4; i++) {
+      flush();
       delay(QUARTER_SECOND_IN_MILLIS);
+      feedWatchdog();
       printCustomChar(byte(FULL_BLOCK_CHAR));
     }
+    flush();
   }
 
   /**
@@ -99,7 +270,7 @@ public:
    * No @return
    */
   void printCustomChar(const byte &c) {
-    lcd.write(c);
+    putChar(c);
   }
 
   /**
@@ -111,7 +282,7 @@ public:
    */
   void printCustomCharAtPosition(const byte col, const byte row, const byte &c) {
     setCursorPosition(col, row);
-    lcd.write(c);
+    putChar(c);
   }
 
   /**
@@ -120,7 +291,21 @@ public:
    * No @return
    */
   void printMessage(const char &message) {
-    lcd.print(message);
+    putChar(message);
+  }
+
+  /**
+   * Function that will print a number on the LCD as a fixed-width field of digits padded with zeros
+   * @param value - the number to print on width digits
+   * No @return
+   */
+  template<byte width>
+  void printZeroPaddedNumber(const unsigned int value) {
+    char digits[width];
+    writeZeroPaddedNumber<width>(digits, value);
+    for (byte i = 0; i < width; i++) {
+      putChar(digits[i]);
+    }
   }
 
   /**
@@ -129,209 +314,283 @@ public:
    * No @return
    */
   void printMessage(const char *message) {
-    lcd.print(message);
+    while (*message) {
+      putChar(*message++);
+    }
   }
 
   /**
    * Function that will print a message from the Flash memory on the LCD
-   * @param message - pointer to the message from the Flash memory to print
+   * @param message - handle of the message from the Flash memory to print
    * No @return
    */
-  void printMessage(const __FlashStringHelper *message) {
-    lcd.print(message);
+  void printMessage(const FlashString &message) {
+    for (unsigned int i = 0; i < message.length; i++) {
+      putChar(message.charAt(i));
+    }
   }
 
   /**
-   * Function that will print a message from the Flash memory on the LCD at a given row with the default LCD left and
-   * right indentation. If the message is longer than the LCD width - the 2 indentations, it will be truncated to fit
-   * @param row - the row to print the message to
-   * @param message - pointer to the message from the Flash memory to print
+   * Function that will print a UI string on the LCD, decoding it while printing
+   * @param id - the id of the UI string to print
    * No @return
    */
-  void printIndentedMessageOnRow(byte row, __FlashStringHelper *message) {
-    // print an indented message on the selected row padded indented left and right by LCD_INDENT_CHARS
-    lcd.setCursor(LCD_INDENT_CHARS, row);
+  void printMessage(const UiStringId id) {
+    UiStringReader reader;
+    reader.open(id);
+    while (reader.hasNext()) {
+      putChar(reader.next());
+    }
+  }
 
-    // cut the message to now allow overflow printing on the lcd
-    char outputCutMessage[LCD_DISPLAY_WIDTH - LCD_INDENT_CHARS];
-    strncpy_P(outputCutMessage, (const char *) message, LCD_DISPLAY_WIDTH - 2 * LCD_INDENT_CHARS);
-    outputCutMessage[LCD_DISPLAY_WIDTH - 2 * LCD_INDENT_CHARS] = '\0';
-    lcd.print(outputCutMessage);
-  }
-
-  /**
-   * Function that will scroll a message on a single row at a custom position and with a custom scrollable output length
-   * without always sending the message to be scrolled
-   * Needs to be called in a loop to allow the scrolling
-   * @param resetMessage - boolean to decide if the function will reset it's saved scrolling data
-   * @param message - pointer to a message of type __FlashStringHelper, to be able to use the flash memory, need to be
-   * set on resetMessage, ignored otherwise
-   * @param col - column to start the scrolling print, need to be set on resetMessage, ignored otherwise
-   * @param row - row to start the scrolling print, need to be set on resetMessage, ignored otherwise
-   * @param maxCutLength - size of the cutted message to be print at a time on the lcd
+  /**
+   * Function that will print a UI string on the LCD at a given row with the default LCD left and right indentation. If
+   * the message is longer than the LCD width - the 2 indentations, it will be truncated to fit
+   * @param row - the row to print the message to
+   * @param id - the id of the UI string to print
    * No @return
    */
-  void printScrollingFlashStringMessage(bool resetMessage = false, __FlashStringHelper *message = nullptr,
-                                        const byte col = 1, const byte row = 1,
-                                        const byte maxCutLength = LCD_DEFAULT_SCROLL_CUT_LENGTH) {
-    static char *paddedMessage = nullptr;
-    static unsigned long lastScrollTime = 0;
-    static byte paddedMessageIndex = 0;
-    static byte sCol = col;
-    static byte sRow = row;
-    static byte sMaxCutLength = maxCutLength;
-
-    if (resetMessage) {
-      lastScrollTime = millis();
-      paddedMessageIndex = 0;
-      sCol = col;
-      sRow = row;
-      sMaxCutLength = maxCutLength;
-
-      // free the memory for the last saved scrollable message
-      delete[] paddedMessage;
-      paddedMessage = nullptr;
-
-      if (message) {
-        paddedMessage = new char[getLengthOfFlashString(message) + 3]; // message length + spacing
-        // copy from the flash memory into the RAM
-        strncpy_P(paddedMessage, (char *) message, getLengthOfFlashString(message));
-        paddedMessage[getLengthOfFlashString(message)] = ' ';
-        paddedMessage[getLengthOfFlashString(message) + 1] = ' ';
-        paddedMessage[getLengthOfFlashString(message) + 2] = '\0';
-      }
-    }
+  void printIndentedMessageOnRow(byte row, const UiStringId id) {
+    // print an indented message on the selected row padded indented left and right by LCD_INDENT_CHARS
+    setCursorPosition(LCD_INDENT_CHARS, row);
 
-    if (!paddedMessage) { // didn't set any message for scroll printing
-      return;
+    // cut the message to now allow overflow printing on the lcd
+    UiStringReader reader;
+    reader.open(id);
+    for (byte i = 0; i < LCD_DISPLAY_WIDTH - 2 * LCD_INDENT_CHARS && reader.hasNext(); i++) {
+      putChar(reader.next());
     }
+  }
 
-    // animate a step for the scrolling message
-    if (millis() - lastScrollTime >= PRINT_MESSAGE_SCROLL_DELAY) {
-      lcd.setCursor(sCol, sRow);
-
-      // construct the scrolling outputCutMessage to be printed
-      char outputCutMessage[sMaxCutLength + 1];
-      if (paddedMessageIndex + sMaxCutLength <
-          strlen(paddedMessage)) { // cut message output contained straight by the padded message
-        strncpy(outputCutMessage, &paddedMessage[paddedMessageIndex], sMaxCutLength);
-      } else { // cut message reached the ending part of the padded message, need to concatenate the starting part create looping scroll effect
-        strncpy(outputCutMessage, &paddedMessage[paddedMessageIndex], strlen(paddedMessage) - paddedMessageIndex);
-        strncpy(&outputCutMessage[strlen(paddedMessage) - paddedMessageIndex], paddedMessage,
-                paddedMessageIndex + sMaxCutLength - strlen(paddedMessage));
-      }
-      outputCutMessage[sMaxCutLength] = '\0';
-      lcd.print(outputCutMessage);
+  /**
+   * Function that starts scrolling a UI string in a region of a row, replacing the message the region was scrolling.
+   * The first window is printed right away, the next ones by update()
+   * @param region - the index of the scrolling region, less than LCD_NUMBER_OF_SCROLL_REGIONS
+   * @param id - the id of the UI string to scroll
+   * @param col - the column where the region starts
+   * @param row - the row of the region
+   * @param width - the number of characters of the region
+   * No @return
+   */
+  void startScrolling(const byte region, const UiStringId id, const byte col = LCD_INDENT_CHARS, const byte row = 1,
+                      const byte width = LCD_DEFAULT_SCROLL_CUT_LENGTH) {
+    scrollers[region].start(id, col, row, width);
+    printScrollerWindow(scrollers[region]);
+  }
 
-      paddedMessageIndex++;
-      lastScrollTime = millis();
-      if (paddedMessageIndex == strlen(paddedMessage)) { // avoid overflow by scrolling too much
-        paddedMessageIndex = 0;
-      }
-    }
+  /**
+   * Function that starts scrolling a message from the RAM in a region of a row, replacing the message the region was
+   * scrolling. The message isn't copied, it must stay valid while it scrolls
+   * @param region - the index of the scrolling region, less than LCD_NUMBER_OF_SCROLL_REGIONS
+   * @param message - pointer to the message from the RAM to scroll
+   * @param col - the column where the region starts
+   * @param row - the row of the region
+   * @param width - the number of characters of the region
+   * No @return
+   */
+  void startScrolling(const byte region, const char *message, const byte col = LCD_INDENT_CHARS, const byte row = 1,
+                      const byte width = LCD_DEFAULT_SCROLL_CUT_LENGTH) {
+    scrollers[region].start(message, col, row, width);
+    printScrollerWindow(scrollers[region]);
   }
 
   /**
-    * Function that will scroll a message on a single row at a custom position and with a custom scrollable output length
-    * without always sending the message to be scrolled
-    * Needs to be called in a loop to allow the scrolling
-    * @param resetMessage - boolean to decide if the function will reset it's saved scrolling data
-    * @param message - pointer to a message of type const char *, to be able to use the RAM, need to be set on
-    * resetMessage, ignored otherwise
-    * @param col - column to start the scrolling print, need to be set on resetMessage, ignored otherwise
-    * @param row - row to start the scrolling print, need to be set on resetMessage, ignored otherwise
-    * @param maxCutLength - size of the cutted message to be print at a time on the lcd
-    * No @return
-    */
-  void printScrollingMessage(bool resetMessage = false, const char *message = nullptr, const byte col = 1,
-                             const byte row = 1,
-                             const byte maxCutLength = LCD_DEFAULT_SCROLL_CUT_LENGTH) {
-    static char *paddedMessage = nullptr;
-    static unsigned long lastScrollTime = 0;
-    static byte paddedMessageIndex = 0;
-    static byte sCol = col;
-    static byte sRow = row;
-    static byte sMaxCutLength = maxCutLength;
-
-    if (resetMessage) {
-      lastScrollTime = millis();
-      paddedMessageIndex = 0;
-      sCol = col;
-      sRow = row;
-      sMaxCutLength = maxCutLength;
-
-      // free the memory for the last saved scrollable message
-      delete[] paddedMessage;
-      paddedMessage = nullptr;
-
-      if (message) {
-        paddedMessage = new char[strlen(message) + 3]; // message length + spacing
-        strncpy(paddedMessage, message, strlen(message));
-        paddedMessage[strlen(message)] = ' ';
-        paddedMessage[strlen(message) + 1] = ' ';
-        paddedMessage[strlen(message) + 2] = '\0';
-      }
-    }
+   * Function that stops the scrolling of a region, its last window is left on the LCD
+   * @param region - the index of the scrolling region
+   * No @return
+   */
+  void stopScrolling(const byte region) {
+    scrollers[region].stop();
+  }
 
-    if (!paddedMessage) { // didn't set any message for scroll printing
-      return;
-    }
+private:
+  // driver to control the lcd, specialized on the lcd pins
+  LcdDriver lcd;
 
-    // construct the scrolling outputCutMessage to be printed
-    if (millis() - lastScrollTime >= PRINT_MESSAGE_SCROLL_DELAY) {
-      lcd.setCursor(sCol, sRow);
-      char outputCutMessage[sMaxCutLength + 1];
-      if (paddedMessageIndex + sMaxCutLength <
-          strlen(paddedMessage)) { // cut message output contained straight by the padded message
-        strncpy(outputCutMessage, &paddedMessage[paddedMessageIndex], sMaxCutLength);
-      } else { // cut message reached the ending part of the padded message, need to concatenate the starting part create looping scroll effect
-        strncpy(outputCutMessage, &paddedMessage[paddedMessageIndex], strlen(paddedMessage) - paddedMessageIndex);
-        strncpy(&outputCutMessage[strlen(paddedMessage) - paddedMessageIndex], paddedMessage,
-                paddedMessageIndex + sMaxCutLength - strlen(paddedMessage));
-      }
-      outputCutMessage[sMaxCutLength] = '\0';
-      lcd.print(outputCutMessage);
+  // characters to be shown on the LCD and characters currently on the glass
+  byte screenBuffer[LCD_DISPLAY_HEIGHT][LCD_DISPLAY_WIDTH];
+  byte glassBuffer[LCD_DISPLAY_HEIGHT][LCD_DISPLAY_WIDTH];
 
-      paddedMessageIndex++;
-      lastScrollTime = millis();
-      if (paddedMessageIndex == strlen(paddedMessage)) { // avoid overflow by scrolling too much
-        paddedMessageIndex = 0;
-      }
-    }
-  }
+  // queue of the bytes to be sent to the LCD, with a bit set in queueCommandFlags for the ones sent as commands
+  byte queueBytes[LCD_QUEUE_SIZE];
+  byte queueCommandFlags[LCD_QUEUE_SIZE / 8];
+  byte queueHead = 0;
+  byte queueLength = 0;
 
-private:
-  // object interface to control the lcd from the LiquidCrystal library
-  LiquidCrystal lcd = LiquidCrystal(LCD_RS, LCD_ENABLE, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+  // cursor in the screen buffer and cursor on the LCD, where the next character queued will be written
+  byte cursorCol = 0;
+  byte cursorRow = 0;
+  byte hardwareCursorCol = 0;
+  byte hardwareCursorRow = 0;
+  bool isCursorShown = false;
+  bool isCursorCommandPending = false; // the command showing or hiding the cursor didn't fit in the queue yet
+
+  int brightness = 0;
+  bool isDimmed = false;
+
+  unsigned long bytesSent = 0;
+
+  // glyphs loaded in the CGRAM slots
+  GlyphCache glyphCache;
+
+  // regions of the LCD scrolling a message
+  Scroller scrollers[LCD_NUMBER_OF_SCROLL_REGIONS];
 
   /**
    * Private constructor for the singleton class
-   * The constructor will set the LCD pins, create the custom characters and set the LCD to the default state
+   * The constructor will set the LCD pins and set the LCD to the default state
    */
   LCD() {
     // setup lcd pins
     pinMode(LCD_INTENSITY_PIN, OUTPUT);
     pinMode(LCD_CONTRAST_PIN, OUTPUT);
 
-    // create custom chars for the lcd
-    createFullBlockChar(lcd);
-    createCupChar(lcd);
-    createUpArrowChar(lcd);
-    createLeftArrowChar(lcd);
-    createDownArrowChar(lcd);
-    createRightArrowChar(lcd);
-    createHeartChar(lcd);
+    // lcd init, the display is on without cursor and blink
+    lcd.begin();
 
-    // lcd init
-    lcd.begin(LCD_DISPLAY_WIDTH, LCD_DISPLAY_HEIGHT);
-    lcd.clear();
-    lcd.noCursor();
-    lcd.noBlink();
+    // the custom chars are loaded in the CGRAM when they are first printed
+    clear();
+    memset(glassBuffer, ' ', sizeof(glassBuffer));
   }
 
   LCD(const LCD &) = delete;
 
   LCD &operator=(const LCD &) = delete;
+
+  /**
+   * Function that computes the command that moves the LCD cursor, as the DDRAM address set command
+   * @param col - the column to move the cursor to
+   * @param row - the row to move the cursor to
+   * @return the command byte
+   */
+  static byte getSetCursorCommand(const byte col, const byte row) {
+    return LCD_SET_DDRAM_ADDRESS_COMMAND | (row * LCD_SECOND_ROW_ADDRESS + col);
+  }
+
+  /**
+   * Function that checks if a character of the screen buffer is a glyph code
+   * @param c - the character
+   * @return true if the character is a glyph code, false otherwise
+   */
+  static bool isGlyphCode(const byte c) {
+    return c >= LCD_FIRST_GLYPH_CODE && c < LCD_FIRST_GLYPH_CODE + LCD_NUMBER_OF_GLYPHS;
+  }
+
+  /**
+   * Function that computes the mask of the CGRAM slots holding glyphs on the glass or in the screen buffer
+   * No @params
+   * @return the mask of the slots, bit i for slot i
+   */
+  byte getVisibleGlyphSlots() const {
+    byte slots = 0;
+    for (byte row = 0; row < LCD_DISPLAY_HEIGHT; row++) {
+      for (byte col = 0; col < LCD_DISPLAY_WIDTH; col++) {
+        byte glassSlot = isGlyphCode(glassBuffer[row][col]) ?
+                         glyphCache.findSlot(glassBuffer[row][col] - LCD_FIRST_GLYPH_CODE) : NO_GLYPH_SLOT;
+        byte screenSlot = isGlyphCode(screenBuffer[row][col]) ?
+                          glyphCache.findSlot(screenBuffer[row][col] - LCD_FIRST_GLYPH_CODE) : NO_GLYPH_SLOT;
+        if (glassSlot != NO_GLYPH_SLOT) {
+          slots |= 1 << glassSlot;
+        }
+        if (screenSlot != NO_GLYPH_SLOT) {
+          slots |= 1 << screenSlot;
+        }
+      }
+    }
+    return slots;
+  }
+
+  /**
+   * Function that queues the command showing or hiding the cursor, as set by isCursorShown. The command stays pending
+   * while the queue is full
+   * No @params
+   * No @return
+   */
+  void enqueueCursorCommand() {
+    if (enqueue(isCursorShown ? LCD_DISPLAY_ON_CURSOR_ON_COMMAND : LCD_DISPLAY_ON_CURSOR_OFF_COMMAND, true)) {
+      isCursorCommandPending = false;
+    }
+  }
+
+  /**
+   * Function that queues the upload of a glyph from the Flash memory in a CGRAM slot. The LCD writes in the CGRAM
+   * after the upload, so the next character needs a cursor move
+   * Expected to be called only if the queue has room for 9 bytes
+   * @param glyph - the index of the glyph in lcdGlyphs
+   * @param slot - the CGRAM slot
+   * No @return
+   */
+  void enqueueGlyphUpload(const byte glyph, const byte slot) {
+    enqueue(HD44780_SET_CGRAM_ADDRESS_COMMAND | (slot << 3), true);
+    for (byte i = 0; i < 8; i++) {
+      enqueue(pgm_read_byte(&lcdGlyphs[glyph][i]), false);
+    }
+    hardwareCursorCol = LCD_DISPLAY_WIDTH + 1; // out of the screen, forces a cursor move
+  }
+
+  /**
+   * Function that adds a byte at the end of the queue to be sent to the LCD
+   * @param value - the byte to send
+   * @param isCommand - true if the byte is sent as a command, false if it is sent as data (a character)
+   * @return true if the byte was queued, false if the queue is full
+   */
+  bool enqueue(const byte value, const bool isCommand) {
+    if (queueLength == LCD_QUEUE_SIZE) {
+      return false;
+    }
+
+    byte index = (queueHead + queueLength) % LCD_QUEUE_SIZE;
+    queueBytes[index] = value;
+    if (isCommand) {
+      queueCommandFlags[index / 8] |= 1 << (index % 8);
+    } else {
+      queueCommandFlags[index / 8] &= ~(1 << (index % 8));
+    }
+    queueLength++;
+    return true;
+  }
+
+  /**
+   * Function that sends to the LCD the byte at the head of the queue and removes it from the queue
+   * Expected to be called only if the queue is not empty
+   * No @params
+   * No @return
+   */
+  void sendQueueHead() {
+    if (queueCommandFlags[queueHead / 8] & (1 << (queueHead % 8))) {
+      lcd.command(queueBytes[queueHead]);
+    } else {
+      lcd.write(queueBytes[queueHead]);
+    }
+    queueHead = (queueHead + 1) % LCD_QUEUE_SIZE;
+    queueLength--;
+    bytesSent++;
+  }
+
+  /**
+   * Function that writes the current window of a scroller in its region of the screen buffer, without moving the cursor
+   * @param scroller - the scroller to print
+   * No @return
+   */
+  void printScrollerWindow(Scroller &scroller) {
+    scroller.beginWindow();
+    for (byte i = 0; i < scroller.getWidth() && scroller.getCol() + i < LCD_DISPLAY_WIDTH; i++) {
+      screenBuffer[scroller.getRow()][scroller.getCol() + i] = scroller.nextWindowChar();
+    }
+  }
+
+  /**
+   * Function that writes a character in the screen buffer at the cursor position and moves the cursor to the right.
+   * Characters written outside the screen are dropped, like on the LCD
+   * @param c - the character byte encoding to write
+   * No @return
+   */
+  void putChar(const byte c) {
+    if (cursorCol < LCD_DISPLAY_WIDTH && cursorRow < LCD_DISPLAY_HEIGHT) {
+      screenBuffer[cursorRow][cursorCol] = c;
+    }
+    cursorCol++;
+  }
 };
 
 #endif
@@ -1,142 +1,121 @@
 /**
- * File defining functions to create custom characters to draw on an LCD
+ * File defining the library of custom characters (glyphs) that can be drawn on an LCD, saved in the Flash memory
  * each custom character has 8 rows and 5 columns
+ * A glyph is printed with its code, between LCD_FIRST_GLYPH_CODE and LCD_FIRST_GLYPH_CODE + 15, codes that the LCD
+ * character ROM doesn't use. The library can be larger than the 8 CGRAM slots of the LCD, the LCD class loads the
+ * glyphs in the slots on demand
  */
 
 #ifndef LCD_CHARACTERS_H
 #define LCD_CHARACTERS_H
 
-#define FULL_BLOCK_CHAR 0
-
-void createFullBlockChar(LiquidCrystal &lcd) {
-  static const byte fullBlockEncoding[8]
-  PROGMEM = {
-      B11111,
-      B11111,
-      B11111,
-      B11111,
-      B11111,
-      B11111,
-      B11111,
-      B11111
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, fullBlockEncoding, sizeof(charEncoding));
-  lcd.createChar(FULL_BLOCK_CHAR, charEncoding);
-}
-
-#define CUP_CHAR 1
-
-void createCupChar(LiquidCrystal &lcd) {
-  static const byte cupEncoding[8]
-  PROGMEM = {
-      B11111,
-      B11111,
-      B01110,
-      B01110,
-      B00100,
-      B00100,
-      B01110,
-      B11111
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, cupEncoding, sizeof(charEncoding));
-  lcd.createChar(CUP_CHAR, charEncoding);
-}
-
-#define UP_ARROW_CHAR 2
-
-void createUpArrowChar(LiquidCrystal &lcd) {
-  static const byte upArrowEncoding[8]
-  PROGMEM = {
-      B00000,
-      B00100,
-      B01110,
-      B11111,
-      B00100,
-      B00100,
-      B00100,
-      B00000
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, upArrowEncoding, sizeof(charEncoding));
-  lcd.createChar(UP_ARROW_CHAR, charEncoding);
-}
-
-#define LEFT_ARROW_CHAR 3
-
-void createLeftArrowChar(LiquidCrystal &lcd) {
-  static const byte leftArrowEncoding[8]
-  PROGMEM = {
-      B00001,
-      B00011,
-      B00111,
-      B01111,
-      B01111,
-      B00111,
-      B00011,
-      B00001
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, leftArrowEncoding, sizeof(charEncoding));
-  lcd.createChar(LEFT_ARROW_CHAR, charEncoding);
-}
-
-#define DOWN_ARROW_CHAR 4
-
-void createDownArrowChar(LiquidCrystal &lcd) {
-  static const byte downArrowEncoding[8]
-  PROGMEM = {
-      B00000,
-      B00100,
-      B00100,
-      B00100,
-      B11111,
-      B01110,
-      B00100,
-      B00000
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, downArrowEncoding, sizeof(charEncoding));
-  lcd.createChar(DOWN_ARROW_CHAR, charEncoding);
-}
-
-#define RIGHT_ARROW_CHAR 5
-
-void createRightArrowChar(LiquidCrystal &lcd) {
-  static const byte rightArrowEncoding[8]
-  PROGMEM = {
-      B10000,
-      B11000,
-      B11100,
-      B11110,
-      B11110,
-      B11100,
-      B11000,
-      B10000
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, rightArrowEncoding, sizeof(charEncoding));
-  lcd.createChar(RIGHT_ARROW_CHAR, charEncoding);
-}
-
-#define HEART_CHAR 6
-
-void createHeartChar(LiquidCrystal &lcd) {
-  static const byte heartEncoding[8]
-  PROGMEM = {
-      B10001,
-      B00000,
-      B01010,
-      B11111,
-      B01110,
-      B00100,
-      B00000,
-      B10001
-  };
-  byte charEncoding[8];
-  memcpy_P(charEncoding, heartEncoding, sizeof(charEncoding));
-  lcd.createChar(HEART_CHAR, charEncoding);
-}
-
-#endif
\ No newline at end of file
+#include "config.h"
+
+#define FULL_BLOCK_CHAR (LCD_FIRST_GLYPH_CODE + 0)
+#define CUP_CHAR (LCD_FIRST_GLYPH_CODE + 1)
+#define UP_ARROW_CHAR (LCD_FIRST_GLYPH_CODE + 2)
+#define DOWN_ARROW_CHAR (LCD_FIRST_GLYPH_CODE + 3)
+#define RIGHT_ARROW_CHAR (LCD_FIRST_GLYPH_CODE + 4)
+#define HEART_CHAR (LCD_FIRST_GLYPH_CODE + 5)
+#define EMPTY_BLOCK_CHAR (LCD_FIRST_GLYPH_CODE + 6)
+#define APPLE_CHAR (LCD_FIRST_GLYPH_CODE + 7)
+#define SKULL_CHAR (LCD_FIRST_GLYPH_CODE + 8)
+
+static const byte lcdGlyphs[][8] PROGMEM = {
+    { // full block
+        B11111,
+        B11111,
+        B11111,
+        B11111,
+        B11111,
+        B11111,
+        B11111,
+        B11111
+    },
+    { // cup
+        B11111,
+        B11111,
+        B01110,
+        B01110,
+        B00100,
+        B00100,
+        B01110,
+        B11111
+    },
+    { // up arrow
+        B00000,
+        B00100,
+        B01110,
+        B11111,
+        B00100,
+        B00100,
+        B00100,
+        B00000
+    },
+    { // down arrow
+        B00000,
+        B00100,
+        B00100,
+        B00100,
+        B11111,
+        B01110,
+        B00100,
+        B00000
+    },
+    { // right arrow
+        B10000,
+        B11000,
+        B11100,
+        B11110,
+        B11110,
+        B11100,
+        B11000,
+        B10000
+    },
+    { // heart
+        B10001,
+        B00000,
+        B01010,
+        B11111,
+        B01110,
+        B00100,
+        B00000,
+        B10001
+    },
+    { // empty block
+        B11111,
+        B10001,
+        B10001,
+        B10001,
+        B10001,
+        B10001,
+        B10001,
+        B11111
+    },
+    { // apple
+        B00010,
+        B00100,
+        B01110,
+        B11111,
+        B11111,
+        B11111,
+        B01110,
+        B00000
+    },
+    { // skull
+        B01110,
+        B10101,
+        B11011,
+        B01110,
+        B01110,
+        B00000,
+        B01110,
+        B00000
+    }
+};
+
+#define LCD_NUMBER_OF_GLYPHS (sizeof(lcdGlyphs) / sizeof(lcdGlyphs[0]))
+static_assert(LCD_NUMBER_OF_GLYPHS <= 16,
+              "the glyph codes fit between LCD_FIRST_GLYPH_CODE and LCD_FIRST_GLYPH_CODE + 15");
+
+#endif
@@ -1,14 +1,17 @@
 /**
  * File for the Led 8x8 Matrix class
  * The Matrix class is a singleton class that allows default control settings on a 8x8 LC Matrix and displaying custom
- * 8x8 configurations
+ * 8x8 icons from the Flash memory
+ * The leds are kept in a frame buffer: setLed() only changes the buffer and marks the row as dirty, the dirty rows are
+ * sent to the matrix by update(), each row in a single register write. The icons are sent right away
  */
 
 #ifndef MATRIX_H
 #define MATRIX_H
 
-#include "LedControl.h"
 #include "config.h"
+#include "matrixIcons.h"
+#include "max7219.h"
 
 class Matrix {
 public:
@@ -18,9 +21,9 @@ public:
    * @return pointer to the instance of the class
    */
   static Matrix *getInstance() {
-    static Matrix *instance = new Matrix();
+    static Matrix instance;
 
-    return instance;
+    return &instance;
   }
 
   /**
@@ -29,288 +32,120 @@ public:
    * No @return
    */
   void setBrightness(const byte &value) {
-    lc.setIntensity(0, value);
+    driver.setIntensity(value);
   }
 
   /**
-   * Function that clears the display - turns off all the leds
-   * No @params
-   * No @return
-   */
-  void clearDisplay() {
-    lc.clearDisplay(0);
-  }
-
-  /**
-   * Functions that sets the state of a led on the matrix
-   * @param row - the row of the led to set
-   * @param col - the column of the led to set
-   * @param state - the state to set the led to
+   * Function that turns the matrix off to save power or back on, the leds are kept while off
+   * @param isShutdown - true to turn the matrix off, false to turn it on
    * No @return
    */
-  void setLed(const byte row, const byte col, const bool state) {
-    lc.setLed(0, row, col, state);
+  void setIsShutdown(const bool isShutdown) {
+    driver.setShutdown(isShutdown);
   }
 
   /**
-   * Functions that turns on all the LEDs on the matrix
+   * Getter for the number of bytes sent to the matrix's row registers since boot
    * No @params
-   * No @return
-   */
-  void activateAll() {
-    for (byte i = 0; i < 8; i++) {
-      lc.setRow(0, i, MAX_DIGITAL_OUTPUT_VALUE);
-    }
-  }
-
-  /**
-   * Function that displays a snake symbol on the matrix
-   * No @params
-   * No @return
+   * @return the number of bytes
    */
-  void displaySnake() {
-    byte symbol[MATRIX_SIZE] = {
-        B00000000,
-        B01110010,
-        B01000111,
-        B01100010,
-        B00110000,
-        B00010000,
-        B01110000,
-        B00000000
-    };
-
-    displaySymbol(symbol);
-  };
-
-  /**
-   * Function that displays a play symbol on the matrix
-   * No @params
-   * No @return
-   */
-  void displayPlay() {
-    byte symbol[MATRIX_SIZE] = {
-        B00100000,
-        B00110000,
-        B00111000,
-        B00111100,
-        B00111100,
-        B00111000,
-        B00110000,
-        B00100000
-    };
-
-    displaySymbol(symbol);
-  }
-
-  /**
-   * Function that displays a settings symbol on the matrix
-   * No @params
-   * No @return
-   */
-  void displaySettings() {
-    byte symbol[MATRIX_SIZE] = {
-        B00011000,
-        B01111110,
-        B01100110,
-        B11011011,
-        B11011011,
-        B01100110,
-        B01111110,
-        B00011000
-    };
-
-    displaySymbol(symbol);
-  }
-
-  /**
-   * Function that displays an me symbol on the matrix
-   * No @params
-   * No @return
-   */
-  void displayAboutMe() {
-    byte symbol[MATRIX_SIZE] = {
-        B10001000,
-        B11011010,
-        B10101000,
-        B10001111,
-        B10001000,
-        B00001111,
-        B01001000,
-        B00001111
-    };
-
-    displaySymbol(symbol);
+  unsigned long getBytesSent() const {
+    return bytesSent;
   }
 
   /**
-   * Function that displays a question mark(?) symbol on the matrix
-   * No @params
-   * No @return
-   */
-  void displayQuestionMark() {
-    byte symbol[MATRIX_SIZE] = {
-        B00111110,
-        B01100110,
-        B01100110,
-        B00001100,
-        B00011000,
-        B00011000,
-        B00000000,
-        B00011000
-    };
-
-    displaySymbol(symbol);
-  }
-
-  /**
-   * Function that displays a cup symbol on the matrix
-   * No @params
-   * No @return
-   */
-  void displayHighScore() {
-    byte symbol[MATRIX_SIZE] = {
-        B11111111,
-        B01111110,
-        B01111110,
-        B00111100,
-        B00111100,
-        B00011000,
-        B00011000,
-        B00111100
-    };
-
-    displaySymbol(symbol);
-  }
-
-  /**
-   * Function that displays a happy face symbol on the matrix
+   * Function that clears the display - turns off all the leds
    * No @params
    * No @return
    */
-  void displayHappyFace() {
-    byte symbol[MATRIX_SIZE] = {
-        B00000000,
-        B00100100,
-        B00100100,
-        B00100100,
-        B00000000,
-        B01000010,
-        B00111100,
-        B00000000
-    };
-
-    displaySymbol(symbol);
+  void clearDisplay() {
+    memset(frame, 0, sizeof(frame));
+    dirtyRows = ALL_ROWS_DIRTY;
+    update();
   }
 
   /**
-   * Function that displays a sad face symbol on the matrix
-   * No @params
+   * Functions that sets the state of a led in the frame buffer, the led changes on the matrix at the next update()
+   * A led outside the matrix is ignored
+   * @param row - the row of the led to set
+   * @param col - the column of the led to set
+   * @param state - the state to set the led to
    * No @return
    */
-  void displaySadFace() {
-    byte symbol[MATRIX_SIZE] = {
-        B00000000,
-        B00100100,
-        B00100100,
-        B00100100,
-        B00000000,
-        B00111100,
-        B01000010,
-        B00000000
-    };
+  void setLed(const byte row, const byte col, const bool state) {
+    if (row >= MATRIX_SIZE || col >= MATRIX_SIZE) {
+      return;
+    }
 
-    displaySymbol(symbol);
+    byte rowValue = state ? frame[row][0] | (0x80 >> col) : frame[row][0] & ~(0x80 >> col);
+    if (rowValue != frame[row][0]) {
+      frame[row][0] = rowValue;
+      dirtyRows |= 1 << row;
+    }
   }
 
   /**
-   * Function that displays number one on the matrix
+   * Function that sends the rows of the frame buffer changed since the last update to the matrix
+   * Needs to be called in a loop
    * No @params
    * No @return
    */
-  void displayOne() {
-    byte symbol[MATRIX_SIZE] = {
-        B00000000,
-        B00000100,
-        B00001100,
-        B00010100,
-        B00000100,
-        B00000100,
-        B00000100,
-        B00000100
-    };
-
-    displaySymbol(symbol);
+  void update() {
+    for (byte i = 0; dirtyRows != 0; i++, dirtyRows >>= 1) {
+      if (dirtyRows & 1) {
+        driver.writeRow(i, frame[i]);
+        bytesSent += 2 * MATRIX_NUM_DRIVER; // the register address and the row of each device
+      }
+    }
   }
 
   /**
-   * Function that displays number two on the matrix
+   * Functions that turns on all the LEDs on the matrix
    * No @params
    * No @return
    */
-  void displayTwo() {
-    byte symbol[MATRIX_SIZE] = {
-        B00000000,
-        B00111100,
-        B00000100,
-        B00000100,
-        B00111100,
-        B00100000,
-        B00100000,
-        B00111100
-    };
-
-    displaySymbol(symbol);
+  void activateAll() {
+    memset(frame, MAX_DIGITAL_OUTPUT_VALUE, sizeof(frame));
+    dirtyRows = ALL_ROWS_DIRTY;
+    update();
   }
 
   /**
-   * Function that displays number three on the matrix
-   * No @params
+   * Function that displays an icon on the matrix
+   * @param icon - the index of the icon in matrixIcons (SNAKE_ICON, PLAY_ICON, ...)
    * No @return
    */
-  void displayThree() {
-    byte symbol[MATRIX_SIZE] = {
-        B00000000,
-        B00111100,
-        B00000100,
-        B00000100,
-        B00111100,
-        B00000100,
-        B00000100,
-        B00111100
-    };
-
-    displaySymbol(symbol);
+  void displayIcon(const byte icon) {
+    for (byte i = 0; i < MATRIX_SIZE; i++) {
+      frame[i][0] = pgm_read_byte(&matrixIcons[icon][i]);
+    }
+    dirtyRows = ALL_ROWS_DIRTY;
+    update();
   }
 
 private:
-  // object interface to control the lc matrix from the LedControl library
-  LedControl lc = LedControl(MATRIX_DIN_PIN, MATRIX_CLOCK_PIN, MATRIX_LOAD_PIN, MATRIX_NUM_DRIVER);
+  static const byte ALL_ROWS_DIRTY = 0xFF;
+
+  // driver of the MAX7219 controlling the matrix
+  MatrixDriver driver;
+  // leds of each row for each device of the chain, the game uses the first device
+  byte frame[MATRIX_SIZE][MATRIX_NUM_DRIVER];
+  // bit i set when the row i of the frame buffer wasn't sent to the matrix
+  byte dirtyRows = 0;
+  unsigned long bytesSent = 0;
 
   /**
    * Private constructor for the singleton class
    * The constructor will set the LC Matrix to the default state
    */
   Matrix() {
-    lc.shutdown(0, false);
-    lc.clearDisplay(0);
+    driver.begin();
+    clearDisplay();
   }
 
   Matrix(const Matrix &) = delete;
 
   Matrix &operator=(const Matrix &) = delete;
-
-  /**
-   * Function that displays a symbol to the matrix
-   * @param symbol - the byte representation of the symbol
-   * No @return
-   */
-  void displaySymbol(byte symbol[]) {
-    for (byte i = 0; i < MATRIX_SIZE; i++) {
-      lc.setRow(0, i, symbol[i]);
-    }
-  }
-
 };
 
 #endif
\ No newline at end of file
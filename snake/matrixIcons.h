@@ -0,0 +1,156 @@
+/**
+ * File defining the icons displayed on the 8x8 led matrix, saved in the Flash memory
+ * each icon has 8 rows of 8 leds, the most significant bit being the first column
+ */
+
+#ifndef MATRIX_ICONS_H
+#define MATRIX_ICONS_H
+
+#define SNAKE_ICON 0
+#define PLAY_ICON 1
+#define SETTINGS_ICON 2
+#define ABOUT_ME_ICON 3
+#define QUESTION_MARK_ICON 4
+#define HIGHSCORE_ICON 5
+#define HAPPY_FACE_ICON 6
+#define SAD_FACE_ICON 7
+#define ONE_ICON 8
+#define TWO_ICON 9
+#define THREE_ICON 10
+#define STATS_ICON 11
+#define DIAGNOSTICS_ICON 12
+
+static const byte matrixIcons[][MATRIX_SIZE] PROGMEM = {
+    { // snake
+        B00000000,
+        B01110010,
+        B01000111,
+        B01100010,
+        B00110000,
+        B00010000,
+        B01110000,
+        B00000000
+    },
+    { // play
+        B00100000,
+        B00110000,
+        B00111000,
+        B00111100,
+        B00111100,
+        B00111000,
+        B00110000,
+        B00100000
+    },
+    { // settings
+        B00011000,
+        B01111110,
+        B01100110,
+        B11011011,
+        B11011011,
+        B01100110,
+        B01111110,
+        B00011000
+    },
+    { // me
+        B10001000,
+        B11011010,
+        B10101000,
+        B10001111,
+        B10001000,
+        B00001111,
+        B01001000,
+        B00001111
+    },
+    { // question mark(?)
+        B00111110,
+        B01100110,
+        B01100110,
+        B00001100,
+        B00011000,
+        B00011000,
+        B00000000,
+        B00011000
+    },
+    { // cup
+        B11111111,
+        B01111110,
+        B01111110,
+        B00111100,
+        B00111100,
+        B00011000,
+        B00011000,
+        B00111100
+    },
+    { // happy face
+        B00000000,
+        B00100100,
+        B00100100,
+        B00100100,
+        B00000000,
+        B01000010,
+        B00111100,
+        B00000000
+    },
+    { // sad face
+        B00000000,
+        B00100100,
+        B00100100,
+        B00100100,
+        B00000000,
+        B00111100,
+        B01000010,
+        B00000000
+    },
+    { // number one
+        B00000000,
+        B00000100,
+        B00001100,
+        B00010100,
+        B00000100,
+        B00000100,
+        B00000100,
+        B00000100
+    },
+    { // number two
+        B00000000,
+        B00111100,
+        B00000100,
+        B00000100,
+        B00111100,
+        B00100000,
+        B00100000,
+        B00111100
+    },
+    { // number three
+        B00000000,
+        B00111100,
+        B00000100,
+        B00000100,
+        B00111100,
+        B00000100,
+        B00000100,
+        B00111100
+    },
+    { // stats bar chart
+        B00000000,
+        B00000010,
+        B00000010,
+        B00001010,
+        B00001010,
+        B00101010,
+        B10101010,
+        B11111111
+    },
+    { // diagnostics chip
+        B00100100,
+        B01111110,
+        B11000011,
+        B01011010,
+        B01011010,
+        B11000011,
+        B01111110,
+        B00100100
+    }
+};
+
+#endif
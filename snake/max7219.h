@@ -0,0 +1,111 @@
+/**
+ * File for the MAX7219 class
+ * The MAX7219 class is a driver for a chain of MAX7219 led drivers, specialized at compile time on its pins. The data,
+ * clock and load pins are bit-banged through their port registers with the port and bit masks resolved at compile
+ * time, so each bit costs a few instructions instead of the digitalWrite() calls of shiftOut(). A register can be
+ * written on all the devices of the chain in a single load frame.
+ * The hardware SPI can't be used since the matrix is wired on A3/A4/A5 instead of the SPI pins
+ */
+
+#ifndef MAX7219_H
+#define MAX7219_H
+
+#include "config.h"
+#include "pins.h"
+
+// MAX7219 registers
+#define MAX7219_FIRST_DIGIT_REGISTER 0x01
+#define MAX7219_DECODE_MODE_REGISTER 0x09
+#define MAX7219_INTENSITY_REGISTER 0x0A
+#define MAX7219_SCAN_LIMIT_REGISTER 0x0B
+#define MAX7219_SHUTDOWN_REGISTER 0x0C
+#define MAX7219_DISPLAY_TEST_REGISTER 0x0F
+
+template<byte dataPin, byte clockPin, byte loadPin, byte numberOfDevices>
+class MAX7219 {
+public:
+  /**
+   * Function that initializes the devices: no decoding, all 8 digits scanned, display test off and the display on
+   * No @params
+   * No @return
+   */
+  void begin() {
+    pinMode(dataPin, OUTPUT);
+    pinMode(clockPin, OUTPUT);
+    pinMode(loadPin, OUTPUT);
+    writePinFast(clockPin, LOW);
+    writePinFast(loadPin, HIGH);
+
+    writeRegisterOnAll(MAX7219_DISPLAY_TEST_REGISTER, 0);
+    writeRegisterOnAll(MAX7219_DECODE_MODE_REGISTER, 0);
+    writeRegisterOnAll(MAX7219_SCAN_LIMIT_REGISTER, 7);
+    setShutdown(false);
+  }
+
+  /**
+   * Function that sets the shutdown mode of the devices, in shutdown the leds are off but the rows are kept
+   * @param isShutdown - true to enter the shutdown mode, false to turn the display on
+   * No @return
+   */
+  void setShutdown(const bool isShutdown) {
+    writeRegisterOnAll(MAX7219_SHUTDOWN_REGISTER, isShutdown ? 0 : 1);
+  }
+
+  /**
+   * Function that sets the leds intensity of the devices
+   * @param value - the intensity, 0 to 15
+   * No @return
+   */
+  void setIntensity(const byte value) {
+    writeRegisterOnAll(MAX7219_INTENSITY_REGISTER, value & 0x0F);
+  }
+
+  /**
+   * Function that writes a row of leds on each device of the chain in a single load frame
+   * @param row - the row to write, 0 to 7
+   * @param values - the leds of the row for each device, values[0] being the first device of the chain
+   * No @return
+   */
+  void writeRow(const byte row, const byte values[]) {
+    writePinFast(loadPin, LOW);
+    for (byte device = numberOfDevices; device > 0; device--) { // the data for the last device goes out first
+      shiftByte(MAX7219_FIRST_DIGIT_REGISTER + row);
+      shiftByte(values[device - 1]);
+    }
+    writePinFast(loadPin, HIGH);
+  }
+
+  /**
+   * Function that writes the same value in a register of all the devices of the chain in a single load frame
+   * @param address - the register address
+   * @param value - the value to write
+   * No @return
+   */
+  void writeRegisterOnAll(const byte address, const byte value) {
+    writePinFast(loadPin, LOW);
+    for (byte device = 0; device < numberOfDevices; device++) {
+      shiftByte(address);
+      shiftByte(value);
+    }
+    writePinFast(loadPin, HIGH);
+  }
+
+private:
+  /**
+   * Function that shifts out a byte, most significant bit first, the devices read the data on the clock's rising edge
+   * @param value - the byte to shift out
+   * No @return
+   */
+  static void shiftByte(const byte value) {
+    for (byte mask = 0x80; mask != 0; mask >>= 1) {
+      writePinFast(dataPin, value & mask);
+      writePinFast(clockPin, HIGH);
+      writePinFast(clockPin, LOW);
+    }
+  }
+};
+
+// driver of the game's led matrix
+typedef MAX7219<MATRIX_DIN_PIN, MATRIX_CLOCK_PIN, MATRIX_LOAD_PIN, MATRIX_NUM_DRIVER> MatrixDriver;
+
+#endif
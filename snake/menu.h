@@ -15,6 +15,10 @@
 #include "matrix.h"
 #include "soundDevice.h"
 #include "highscores.h"
+#include "stats.h"
+#include "snapshot.h"
+#include "diagnostics.h"
+#include "menuTree.h"
 
 class Menu {
 public:
@@ -24,9 +28,9 @@ public:
    * @return pointer to the instance of the class
    */
   static Menu *getInstance() {
-    static Menu *instance = new Menu();
+    static Menu instance;
 
-    return instance;
+    return &instance;
   }
 
   /**
@@ -47,11 +51,10 @@ public:
         soundDevice->playSound(NOTE_A4, TONE_DURATION);
       }
 
-      bool resetMenu = changeMenu();
+      bool resetMenu = runSelectedAction();
       if (resetMenu) {
         menuSectionIndex = 1; // reset section index on switching back and forth
         lcdNeedsUpdating = true;
-        loadMenuSectionItems();
       }
     } else { // scrolling in the menu
       YDirection yDirection = joystick->detectMovementOnYAxis();
@@ -62,7 +65,15 @@ public:
         }
       }
 
-      if (yDirection == YDirection::DOWN && menuSectionIndex < numbersMenuSections[currentMenu] - 1) {
+      // the highscores page shows the board of another difficulty level on moves on the x-axis
+      XDirection xDirection = currentMenu == MenuItem::HIGHSCORES ? joystick->detectMovementOnXAxis()
+                                                                  : XDirection::MIDDLE;
+      if (xDirection != XDirection::MIDDLE) {
+        changeHighscoresDifficulty(xDirection);
+        lcdNeedsUpdating = true;
+      }
+
+      if (yDirection == YDirection::DOWN && menuSectionIndex < currentPage.numberOfEntries - 1) {
         menuSectionIndex++;
         lcdNeedsUpdating = true;
       } else if (yDirection == YDirection::UP && menuSectionIndex > 1) {
@@ -71,13 +82,19 @@ public:
       }
     }
 
+    // the diagnostics page shows live values
+    if (currentMenu == MenuItem::DIAGNOSTICS &&
+        millis() - lastDiagnosticsRefreshTimestamp >= DIAGNOSTICS_REFRESH_INTERVAL) {
+      lastDiagnosticsRefreshTimestamp = millis();
+      lcdNeedsUpdating = true;
+    }
+
     if (lcdNeedsUpdating) {
       showMenuSections();
       lcdNeedsUpdating = false;
     }
 
-    // scroll on flash string message if any
-    lcd->printScrollingFlashStringMessage();
+    soundDevice->update();
 
     return requestToPlayGame;
   }
@@ -88,15 +105,26 @@ public:
    * No @return
    */
   void resetMenu() {
-    currentMenu = MenuItem::MAIN;
+    openMenu(MenuItem::MAIN);
     menuSectionIndex = 1;
     lcdNeedsUpdating = true;
     requestToPlayGame = false;
+    requestToContinueGame = false;
     changeMatrixSymbol();
   }
 
+  /**
+   * Function that checks if the game requested to be played is the game saved in the snapshot
+   * No @params
+   * @return true if the saved game should be continued, false for a new game
+   */
+  bool getIsContinueRequested() const {
+    return requestToContinueGame;
+  }
+
   /**
    * Function that presents the start message with theme song.
+   * Holding the switch during the intro ends it and opens the hidden diagnostics page
    * Need to be called in a loop
    * No @params
    * @return true if the intro is still running, false when the intro ended
@@ -105,21 +133,24 @@ public:
     static bool firstCall = true;
 
     if (firstCall) {
-      lcMatrix->displaySnake();
+      lcMatrix->displayIcon(SNAKE_ICON);
       firstCall = false;
-      lcd->printScrollingFlashStringMessage(true, F("Welcome! Let's play Snake!"), 1, 1);
+      lcd->startScrolling(LCD_SECOND_ROW_SCROLL_REGION, INTRO_MESSAGE_STRING);
       if (settings->getIsSoundOn()) {
-        soundDevice->playSong(true);
+        soundDevice->startSong(TRACK_INTRO);
       }
     }
 
-    if (settings->getIsSoundOn()) {
-      soundDevice->playSong();
-    }
-    lcd->printScrollingFlashStringMessage();
+    soundDevice->update();
 
-    if (millis() >= INTRO_MESSAGE_TIME_IN_MILLIS) {
-      lcd->printScrollingFlashStringMessage(true, nullptr);
+    bool isDiagnosticsRequested = joystick->isSwitchHeld();
+    if (isDiagnosticsRequested || millis() >= INTRO_MESSAGE_TIME_IN_MILLIS) {
+      lcd->stopScrolling(LCD_SECOND_ROW_SCROLL_REGION);
+      soundDevice->stopSong();
+      if (isDiagnosticsRequested) {
+        openMenu(MenuItem::DIAGNOSTICS);
+        changeMatrixSymbol();
+      }
       return false;
     }
 
@@ -137,20 +168,27 @@ private:
 
   Settings *settings = nullptr;
   Highscores *highscores = nullptr;
+  Stats *stats = nullptr;
+  Snapshot *snapshot = nullptr;
+  Diagnostics *diagnostics = nullptr;
 
   MenuItem currentMenu = MenuItem::MAIN;
+  MenuPage currentPage; // header of the current menu page copied from the Flash memory
   byte menuSectionIndex = 1;
-  const byte numbersMenuSections[6] = {6, 0, 7, 9, 5, 3};
-  __FlashStringHelper *menuSectionsMessage[9] = {nullptr};
+  byte highscoresDifficulty = MIN_DIFFICULTY_LEVEL; // difficulty level of the board shown on the highscores page
+
+  unsigned long lastDiagnosticsRefreshTimestamp = 0;
 
   bool lcdNeedsUpdating = true;
   bool requestToPlayGame = false;
+  bool requestToContinueGame = false;
 
   /**
    * Private constructor for the singleton class
    * The constructor will get the interfaces of the input & output devices to present the game
-   * and the settings & highscores to have access to the game's settings and highscores
-   * Will update the devices settings using the saved settings from storage and load the first menu section items
+   * and the settings, highscores, stats & diagnostics to have access to the game's settings, highscores, statistics
+   * and the unit's measurements
+   * Will update the devices settings using the saved settings from storage and open the main menu
    */
   Menu() {
     joystick = Joystick::getInstance();
@@ -160,13 +198,16 @@ private:
 
     settings = Settings::getInstance();
     highscores = Highscores::getInstance();
+    stats = Stats::getInstance();
+    snapshot = Snapshot::getInstance();
+    diagnostics = Diagnostics::getInstance();
 
     updateLcdContrast(settings->getLcdContrast());
     updateLcdBrightness(settings->getLcdBrightness());
     updateMatrixBrightness(settings->getMatrixBrightness());
     updateGameDifficulty(settings->getGameDifficulty());
 
-    loadMenuSectionItems();
+    openMenu(MenuItem::MAIN);
   }
 
   Menu(const Menu &) = delete;
@@ -174,61 +215,59 @@ private:
   Menu &operator=(const Menu &) = delete;
 
   /**
-   * Function that will load the current menu section's messages
-   * No @params
+   * Function that opens a menu page, copying its header from the Flash memory
+   * @param menu - the menu to open
    * No @return
    */
-  void loadMenuSectionItems() {
-    static const char backMessage[]
-    PROGMEM = "Back";
-
-    switch (currentMenu) {
-      case MenuItem::MAIN:
-        menuSectionsMessage[0] = F("<Snake!>");
-        menuSectionsMessage[1] = F("Play Snake!");
-        menuSectionsMessage[2] = F("Highscores");
-        menuSectionsMessage[3] = F("Settings");
-        menuSectionsMessage[4] = F("About");
-        menuSectionsMessage[5] = F("How to play?");
-        break;
-      case MenuItem::PLAY:
-        break;
-      case MenuItem::HIGHSCORES:
-        menuSectionsMessage[0] = F("<Highscores>");
-        // can't save to progmem dynamically the char* for scores, will use exception in print for this
-        menuSectionsMessage[6] = (__FlashStringHelper *) backMessage;
-        break;
-      case MenuItem::SETTINGS:
-        menuSectionsMessage[0] = F("<Settings>");
-        menuSectionsMessage[1] = F("Change name");
-        menuSectionsMessage[2] = F("Change LCD Contrast");
-        menuSectionsMessage[3] = F("Change LCD Brightness");
-        menuSectionsMessage[4] = F("Change Matrix Brightness");
-        menuSectionsMessage[5] = F("Change Difficulty");
-        menuSectionsMessage[6] = F("Reset Highscores");
-        if (settings->getIsSoundOn()) {
-          menuSectionsMessage[7] = F("Sound is ON. Press SW to turn it OFF");
-        } else {
-          menuSectionsMessage[7] = F("Sound is OFF. Press SW to turn it ON");
-        }
-        menuSectionsMessage[8] = (__FlashStringHelper *) backMessage;
-        break;
-      case MenuItem::ABOUT:
-        menuSectionsMessage[0] = F("<About>");
-        menuSectionsMessage[1] = F("Title: Snake");
-        menuSectionsMessage[2] = F("By: George Radu");
-        menuSectionsMessage[3] = F("Github username: george-radu-cs");
-        menuSectionsMessage[4] = (__FlashStringHelper *) backMessage;
-        break;
-      case MenuItem::HOW_TO_PLAY:
-        menuSectionsMessage[0] = F("<How to play?>");
-        menuSectionsMessage[1] = F(
-            "Use the joystick to move ^<v>, can't move diagonally. Eat apples to grow and get points. Be carefull not to eat yourself or exit the matrix. Don't go too long without eating or you will lose lives. Higher difficulty => higher score.");
-        menuSectionsMessage[2] = (__FlashStringHelper *) backMessage;
-        break;
-      default:
-        break;
+  void openMenu(const MenuItem menu) {
+    currentMenu = menu;
+    memcpy_P(&currentPage, &menuPages[menu], sizeof(currentPage));
+    if (menu == MenuItem::HIGHSCORES) { // start with the board of the difficulty level set
+      highscoresDifficulty = settings->getGameDifficulty();
+    }
+  }
+
+  /**
+   * Function that changes the difficulty level of the board shown on the highscores page, going around after the
+   * first and the last levels
+   * @param xDirection - RIGHT for the next level, LEFT for the previous one
+   * No @return
+   */
+  void changeHighscoresDifficulty(const XDirection xDirection) {
+    if (xDirection == XDirection::RIGHT) {
+      highscoresDifficulty = highscoresDifficulty < MAX_DIFFICULTY_LEVEL ? highscoresDifficulty + 1
+                                                                         : MIN_DIFFICULTY_LEVEL;
+    } else {
+      highscoresDifficulty = highscoresDifficulty > MIN_DIFFICULTY_LEVEL ? highscoresDifficulty - 1
+                                                                         : MAX_DIFFICULTY_LEVEL;
+    }
+  }
+
+  /**
+   * Function that reads an entry of the current menu page from the Flash memory
+   * @param index - the index of the entry in the page, 0 being the page title
+   * @return the entry
+   */
+  MenuEntry getEntry(const byte index) const {
+    MenuEntry entry;
+    memcpy_P(&entry, &currentPage.entries[index], sizeof(entry));
+    return entry;
+  }
+
+  /**
+   * Function that returns the label of a menu entry, the sound entry's label depends on the sound setting and the
+   * continue entry's label depends on a game being saved
+   * @param entry - the menu entry
+   * @return the label of the entry
+   */
+  UiStringId getEntryLabel(const MenuEntry &entry) const {
+    if (entry.action == MenuAction::TOGGLE_SOUND && !settings->getIsSoundOn()) {
+      return SOUND_OFF_STRING;
+    }
+    if (entry.action == MenuAction::CONTINUE_GAME && !snapshot->getIsSaved()) {
+      return NO_SAVED_GAME_STRING;
     }
+    return entry.label;
   }
 
   /**
@@ -239,45 +278,8 @@ private:
   void showMenuSections() {
     lcd->clear();
 
-    if (currentMenu == MenuItem::HIGHSCORES) { // highscores exception
-      lcd->printScrollingFlashStringMessage(true, nullptr);
-
-      if (menuSectionIndex == 1) {
-        lcd->printIndentedMessageOnRow(0, menuSectionsMessage[menuSectionIndex - 1]); // <highscores>
-      } else {
-        char buffer[15];
-        sprintf(buffer, "<%d.%s:%03d>", menuSectionIndex - 1,
-                highscores->getHighscoresDataArray()[menuSectionIndex - 2].playerName,
-                highscores->getHighscoresDataArray()[menuSectionIndex - 2].score);
-        buffer[14] = '\0';
-        lcd->setCursorPosition(1, 0);
-        lcd->printMessage(buffer);
-      }
-
-      if (menuSectionIndex == numbersMenuSections[MenuItem::HIGHSCORES] - 1) {
-        lcd->printIndentedMessageOnRow(1, menuSectionsMessage[menuSectionIndex]); // back
-      } else {
-        char buffer[15];
-        sprintf(buffer, "<%d.%s:%03d>", menuSectionIndex,
-                highscores->getHighscoresDataArray()[menuSectionIndex - 1].playerName,
-                highscores->getHighscoresDataArray()[menuSectionIndex - 1].score);
-        buffer[14] = '\0';
-        lcd->setCursorPosition(1, 1);
-        lcd->printMessage(buffer);
-      }
-    } else { // normal menus
-      // first row always fixed size
-      lcd->printIndentedMessageOnRow(0, menuSectionsMessage[menuSectionIndex - 1]);
-
-      // second row fixed size or scrolling depending on the section message length
-      if (getLengthOfFlashString(menuSectionsMessage[menuSectionIndex]) <= 14) {
-        lcd->printScrollingFlashStringMessage(true, nullptr);
-        lcd->printIndentedMessageOnRow(1, menuSectionsMessage[menuSectionIndex]);
-      } else {
-        lcd->printIndentedMessageOnRow(1, menuSectionsMessage[menuSectionIndex]);
-        lcd->printScrollingFlashStringMessage(true, menuSectionsMessage[menuSectionIndex], 1, 1);
-      }
-    }
+    printEntryOnRow(0, menuSectionIndex - 1);
+    printEntryOnRow(1, menuSectionIndex);
 
     // print helper arrows
     lcd->printCustomCharAtPosition(0, 1, byte(RIGHT_ARROW_CHAR)); // indicate current section in menu
@@ -286,82 +288,131 @@ private:
     if (menuSectionIndex > 1) {
       lcd->printCustomCharAtPosition(15, 0, byte(UP_ARROW_CHAR));
     }
-    if (menuSectionIndex < numbersMenuSections[currentMenu] - 1) {
+    if (menuSectionIndex < currentPage.numberOfEntries - 1) {
       lcd->printCustomCharAtPosition(15, 1, byte(DOWN_ARROW_CHAR));
     }
   }
 
   /**
-   * Function that changes the menu states based on the current menu and the current section index selected
+   * Function that prints an entry of the current menu page on a row of the LCD. The highscore entries show the
+   * highscore, the stat & diagnostic entries show their value, the first row is always fixed size and the second row
+   * scrolls the labels too long to fit
+   * @param row - the row to print the entry on
+   * @param index - the index of the entry in the page
+   * No @return
+   */
+  void printEntryOnRow(const byte row, const byte index) {
+    MenuEntry entry = getEntry(index);
+    UiStringId label = getEntryLabel(entry);
+
+    if (entry.action == MenuAction::SHOW_HIGHSCORE) {
+      lcd->setCursorPosition(1, row);
+      printHighscore(entry.argument);
+    } else if (entry.action == MenuAction::SHOW_HIGHSCORES_TITLE) { // the title ends with the board's difficulty
+      lcd->printIndentedMessageOnRow(row, label);
+      lcd->printZeroPaddedNumber<1>(highscoresDifficulty);
+      lcd->printMessage('>');
+    } else if (entry.action == MenuAction::SHOW_STAT) { // the label is followed by the statistic's value
+      lcd->printIndentedMessageOnRow(row, label);
+      lcd->printMessage(':');
+      lcd->printZeroPaddedNumber<5>(min(stats->getStat(entry.argument), 65535UL));
+    } else if (entry.action == MenuAction::SHOW_DIAGNOSTIC) { // the label is followed by the live value
+      lcd->printIndentedMessageOnRow(row, label);
+      lcd->printMessage(':');
+      lcd->printZeroPaddedNumber<5>(diagnostics->getDiagnostic(entry.argument));
+    } else if (row == 1 && getUiStringLength(label) > LCD_DEFAULT_SCROLL_CUT_LENGTH) {
+      lcd->startScrolling(LCD_SECOND_ROW_SCROLL_REGION, label);
+    } else {
+      lcd->printIndentedMessageOnRow(row, label);
+    }
+  }
+
+  /**
+   * Function that prints a highscore of the board shown at the LCD cursor as <place.name:score>
+   * @param place - the place of the highscore on the board, starting from 1
+   * No @return
+   */
+  void printHighscore(const byte place) {
+    Highscores::HighscoreEntry highscore = highscores->getHighscore(highscoresDifficulty, place - 1);
+    lcd->printMessage('<');
+    lcd->printZeroPaddedNumber<1>(place);
+    lcd->printMessage('.');
+    lcd->printMessage(highscore.playerName);
+    lcd->printMessage(':');
+    lcd->printZeroPaddedNumber<3>(highscore.score);
+    lcd->printMessage('>');
+  }
+
+  /**
+   * Function that runs the action of the selected entry of the current menu page
    * No @params
-   * @return boolean in case the LCD needs to be updated after the change
+   * @return boolean in case the LCD needs to be updated after the action
    */
-  bool changeMenu() {
-    switch (currentMenu) {
-      case MenuItem::MAIN:
-        currentMenu = menuSectionIndex;
-        if (menuSectionIndex == MenuItem::PLAY) {
-          requestToPlayGame = true;
-        }
-        menuSectionIndex = 1;
-        break;
-      case MenuItem::PLAY:
+  bool runSelectedAction() {
+    MenuEntry entry = getEntry(menuSectionIndex);
+
+    switch (entry.action) {
+      case MenuAction::PLAY_GAME:
+        requestToPlayGame = true;
+        openMenu(MenuItem(entry.argument));
         break;
-      case MenuItem::HIGHSCORES:
-        if (menuSectionIndex == numbersMenuSections[MenuItem::HIGHSCORES] - 1) {
-          currentMenu = MenuItem::MAIN;
-          menuSectionIndex = 1;
-        } else {
-          return false;
+      case MenuAction::CONTINUE_GAME:
+        if (!snapshot->getIsSaved()) {
+          return false; // no game to continue
         }
+        requestToPlayGame = true;
+        requestToContinueGame = true;
+        openMenu(MenuItem(entry.argument));
         break;
-      case MenuItem::SETTINGS:
-        if (menuSectionIndex == CHANGE_NAME) {
-          changePlayerNameMenu();
-        } else if (menuSectionIndex == CHANGE_LCD_CONTRAST) {
-          sliderMenu(settings->getLcdContrast(), MAX_LCD_CONTRAST_BLOCK_COUNT, &updateLcdContrast);
-        } else if (menuSectionIndex == CHANGE_LCD_BRIGHTNESS) {
-          sliderMenu(settings->getLcdBrightness(), MAX_LCD_BRIGHTNESS_BLOCK_COUNT, &updateLcdBrightness);
-        } else if (menuSectionIndex == CHANGE_MATRIX_BRIGHTNESS) {
-          lcMatrix->activateAll();
-          sliderMenu(settings->getMatrixBrightness(), MAX_MATRIX_BRIGHTNESS_BLOCK_COUNT, &updateMatrixBrightness);
-        } else if (menuSectionIndex == CHANGE_DIFFICULTY) {
-          sliderMenu(settings->getGameDifficulty(), MAX_DIFFICULTY_BLOCK_COUNT, &updateGameDifficulty);
-        } else if (menuSectionIndex == RESET_HIGHSCORES) {
-          highscores->resetHighscores();
-        } else if (menuSectionIndex == CHANGE_SOUND_ON_OFF) {
-          settings->setIsSoundOn(!settings->getIsSoundOn());
-          settings->saveInStorage();
-        } else if (menuSectionIndex == numbersMenuSections[MenuItem::SETTINGS] - 1) {
-          currentMenu = MenuItem::MAIN;
-          menuSectionIndex = 1;
-        }
+      case MenuAction::OPEN_MENU:
+        openMenu(MenuItem(entry.argument));
         break;
-      case MenuItem::ABOUT:
-        if (menuSectionIndex == numbersMenuSections[MenuItem::ABOUT] - 1) {
-          currentMenu = MenuItem::MAIN;
-          menuSectionIndex = 1;
-        } else {
-          return false;
-        }
+      case MenuAction::CHANGE_NAME:
+        changePlayerNameMenu();
         break;
-      case MenuItem::HOW_TO_PLAY:
-        if (menuSectionIndex == 1) {
-          return false;
-        }
-        if (menuSectionIndex == numbersMenuSections[MenuItem::HOW_TO_PLAY] - 1) {
-          currentMenu = MenuItem::MAIN;
-          menuSectionIndex = 1;
-        }
+      case MenuAction::CHANGE_SLIDER_SETTING:
+        changeSliderSetting(entry.argument);
         break;
-      default:
+      case MenuAction::RESET_HIGHSCORES:
+        highscores->resetHighscores();
         break;
+      case MenuAction::TOGGLE_SOUND:
+        settings->setIsSoundOn(!settings->getIsSoundOn());
+        settings->saveInStorage();
+        break;
+      default: // the entry only shows information
+        return false;
     }
 
     changeMatrixSymbol();
     return true;
   }
 
+  /**
+   * Function that enters the slider menu of a setting
+   * @param slider - the setting changed by the slider (LCD_CONTRAST_SLIDER, LCD_BRIGHTNESS_SLIDER, ...)
+   * No @return
+   */
+  void changeSliderSetting(const byte slider) {
+    switch (slider) {
+      case LCD_CONTRAST_SLIDER:
+        sliderMenu(settings->getLcdContrast(), MAX_LCD_CONTRAST_BLOCK_COUNT, &updateLcdContrast);
+        break;
+      case LCD_BRIGHTNESS_SLIDER:
+        sliderMenu(settings->getLcdBrightness(), MAX_LCD_BRIGHTNESS_BLOCK_COUNT, &updateLcdBrightness);
+        break;
+      case MATRIX_BRIGHTNESS_SLIDER:
+        lcMatrix->activateAll();
+        sliderMenu(settings->getMatrixBrightness(), MAX_MATRIX_BRIGHTNESS_BLOCK_COUNT, &updateMatrixBrightness);
+        break;
+      case DIFFICULTY_SLIDER:
+        sliderMenu(settings->getGameDifficulty(), MAX_DIFFICULTY_BLOCK_COUNT, &updateGameDifficulty);
+        break;
+      default:
+        break;
+    }
+  }
+
   /**
    * Function that enters the menu for changing the player name menu.
    * The menu is running in a loop and requires the user to save the name before exiting.
@@ -378,7 +429,7 @@ private:
     lcd->setCursorPosition(LCD_DISPLAY_WIDTH - padding, 0);
     lcd->printMessage(">");
     lcd->setCursorPosition(0, 1);
-    lcd->printMessage("Press SW to save");
+    lcd->printMessage(PRESS_SW_TO_SAVE_STRING);
     lcd->setCursorPosition(padding, 0);
     lcd->showCursor();
 
@@ -387,6 +438,8 @@ private:
     strcpy(name, settings->getPlayerName());
 
     while (!joystick->isSwitchPressed()) { // user didn't confirm the save of the player name
+      feedWatchdog();
+      lcd->update();
       XDirection xDirection = joystick->detectMovementOnXAxis();
       YDirection yDirection = joystick->detectMovementOnYAxis();
       if (xDirection != XDirection::MIDDLE) {
@@ -454,18 +507,20 @@ private:
     lcd->clear();
     byte padding = (LCD_DISPLAY_WIDTH - 2 - maxBlockCount) / 2;
     lcd->setCursorPosition(padding, 0);
-    lcd->printMessage(F("-"));
+    lcd->printMessage(FLASH_STRING("-"));
     for (byte i = 0; i < activeBlockCount; i++) {
       lcd->printCustomChar(byte(FULL_BLOCK_CHAR));
     }
     for (byte i = activeBlockCount; i < maxBlockCount; i++) {
-      lcd->printMessage(F(" "));
+      lcd->printCustomChar(byte(EMPTY_BLOCK_CHAR));
     }
-    lcd->printMessage(F("+"));
+    lcd->printMessage(FLASH_STRING("+"));
     lcd->setCursorPosition(0, 1);
-    lcd->printMessage(F("Press SW to save"));
+    lcd->printMessage(PRESS_SW_TO_SAVE_STRING);
 
     while (!joystick->isSwitchPressed()) { // user didn't confirm the save of the new setting
+      feedWatchdog();
+      lcd->update();
       XDirection xDirection = joystick->detectMovementOnXAxis();
       if (xDirection == XDirection::RIGHT && activeBlockCount < maxBlockCount) {
         lcd->setCursorPosition(padding + 1 + activeBlockCount, 0);
@@ -473,7 +528,7 @@ private:
         activeBlockCount++;
       } else if (xDirection == XDirection::LEFT && activeBlockCount > 1) {
         lcd->setCursorPosition(padding + activeBlockCount, 0);
-        lcd->printMessage(F(" "));
+        lcd->printCustomChar(byte(EMPTY_BLOCK_CHAR));
         activeBlockCount--;
       }
 
@@ -544,28 +599,7 @@ private:
    * No @return
    */
   void changeMatrixSymbol() {
-    switch (currentMenu) {
-      case MenuItem::MAIN:
-        lcMatrix->displaySnake();
-        break;
-      case MenuItem::PLAY:
-        lcMatrix->displayPlay();
-        break;
-      case MenuItem::HIGHSCORES:
-        lcMatrix->displayHighScore();
-        break;
-      case MenuItem::SETTINGS:
-        lcMatrix->displaySettings();
-        break;
-      case MenuItem::ABOUT:
-        lcMatrix->displayAboutMe();
-        break;
-      case MenuItem::HOW_TO_PLAY:
-        lcMatrix->displayQuestionMark();
-        break;
-      default:
-        break;
-    }
+    lcMatrix->displayIcon(currentPage.icon);
   }
 };
 
@@ -0,0 +1,131 @@
+/**
+ * File defining the menu tree of the game, saved in the Flash memory
+ * Each menu is a page of entries: the first entry is the page's title, the next ones are the sections the user can
+ * select. An entry has a label and the action run when the switch is pressed on it, with an argument: the page opened,
+ * the setting changed by a slider or the highscore shown instead of the label. Each page also has the icon displayed on
+ * the matrix while the page is open. Adding a menu only needs its entries and a line in menuPages
+ */
+
+#ifndef MENU_TREE_H
+#define MENU_TREE_H
+
+#include "config.h"
+#include "enums.h"
+#include "uiStrings.h"
+#include "matrixIcons.h"
+
+/**
+ * struct for an entry of a menu page saved in the Flash memory
+ */
+struct MenuEntry {
+  UiStringId label;
+  MenuAction action;
+  byte argument;
+};
+
+/**
+ * struct for a menu page saved in the Flash memory
+ */
+struct MenuPage {
+  const MenuEntry *entries;
+  byte numberOfEntries;
+  byte icon;
+};
+
+// build a menu entry labeled with a UI string from uiStrings.h
+#define MENU_ENTRY(label, action, argument) {label##_STRING, MenuAction::action, argument}
+
+static const MenuEntry mainMenuEntries[] PROGMEM = {
+    MENU_ENTRY(MAIN_TITLE, NONE, 0),
+    MENU_ENTRY(PLAY, PLAY_GAME, MenuItem::PLAY),
+    MENU_ENTRY(CONTINUE, CONTINUE_GAME, MenuItem::PLAY), // labeled with NO_SAVED_GAME while no game is saved
+    MENU_ENTRY(HIGHSCORES, OPEN_MENU, MenuItem::HIGHSCORES),
+    MENU_ENTRY(STATS, OPEN_MENU, MenuItem::STATS),
+    MENU_ENTRY(SETTINGS, OPEN_MENU, MenuItem::SETTINGS),
+    MENU_ENTRY(ABOUT, OPEN_MENU, MenuItem::ABOUT),
+    MENU_ENTRY(HOW_TO_PLAY, OPEN_MENU, MenuItem::HOW_TO_PLAY),
+};
+
+// the highscore entries show the highscore of their place instead of their label, from the board of the difficulty
+// level shown in the title
+static const MenuEntry highscoresMenuEntries[] PROGMEM = {
+    MENU_ENTRY(HIGHSCORES_TITLE, SHOW_HIGHSCORES_TITLE, 0),
+    MENU_ENTRY(HIGHSCORES, SHOW_HIGHSCORE, 1),
+    MENU_ENTRY(HIGHSCORES, SHOW_HIGHSCORE, 2),
+    MENU_ENTRY(HIGHSCORES, SHOW_HIGHSCORE, 3),
+    MENU_ENTRY(HIGHSCORES, SHOW_HIGHSCORE, 4),
+    MENU_ENTRY(HIGHSCORES, SHOW_HIGHSCORE, 5),
+    MENU_ENTRY(BACK, OPEN_MENU, MenuItem::MAIN),
+};
+static_assert(sizeof(highscoresMenuEntries) / sizeof(MenuEntry) == NUMBER_OF_HIGHSCORES_SAVED + 2,
+              "the highscores menu needs an entry for each highscore saved");
+
+static const MenuEntry settingsMenuEntries[] PROGMEM = {
+    MENU_ENTRY(SETTINGS_TITLE, NONE, 0),
+    MENU_ENTRY(CHANGE_NAME, CHANGE_NAME, 0),
+    MENU_ENTRY(CHANGE_LCD_CONTRAST, CHANGE_SLIDER_SETTING, LCD_CONTRAST_SLIDER),
+    MENU_ENTRY(CHANGE_LCD_BRIGHTNESS, CHANGE_SLIDER_SETTING, LCD_BRIGHTNESS_SLIDER),
+    MENU_ENTRY(CHANGE_MATRIX_BRIGHTNESS, CHANGE_SLIDER_SETTING, MATRIX_BRIGHTNESS_SLIDER),
+    MENU_ENTRY(CHANGE_DIFFICULTY, CHANGE_SLIDER_SETTING, DIFFICULTY_SLIDER),
+    MENU_ENTRY(RESET_HIGHSCORES, RESET_HIGHSCORES, 0),
+    MENU_ENTRY(SOUND_ON, TOGGLE_SOUND, 0), // labeled with SOUND_OFF while the sound is off
+    MENU_ENTRY(BACK, OPEN_MENU, MenuItem::MAIN),
+};
+
+static const MenuEntry aboutMenuEntries[] PROGMEM = {
+    MENU_ENTRY(ABOUT_TITLE, NONE, 0),
+    MENU_ENTRY(ABOUT_GAME_TITLE, NONE, 0),
+    MENU_ENTRY(ABOUT_AUTHOR, NONE, 0),
+    MENU_ENTRY(ABOUT_GITHUB, NONE, 0),
+    MENU_ENTRY(BACK, OPEN_MENU, MenuItem::MAIN),
+};
+
+// the stat entries show the value of their statistic after their label
+static const MenuEntry statsMenuEntries[] PROGMEM = {
+    MENU_ENTRY(STATS_TITLE, NONE, 0),
+    MENU_ENTRY(STAT_GAMES_PLAYED, SHOW_STAT, STAT_GAMES_PLAYED),
+    MENU_ENTRY(STAT_FOOD_EATEN, SHOW_STAT, STAT_FOOD_EATEN),
+    MENU_ENTRY(STAT_LONGEST_SNAKE, SHOW_STAT, STAT_LONGEST_SNAKE),
+    MENU_ENTRY(STAT_WALL_DEATHS, SHOW_STAT, STAT_WALL_DEATHS),
+    MENU_ENTRY(STAT_SELF_DEATHS, SHOW_STAT, STAT_SELF_DEATHS),
+    MENU_ENTRY(STAT_STARVATION_DEATHS, SHOW_STAT, STAT_STARVATION_DEATHS),
+    MENU_ENTRY(STAT_GAMES_WON, SHOW_STAT, STAT_GAMES_WON),
+    MENU_ENTRY(STAT_PLAY_TIME_MINUTES, SHOW_STAT, STAT_PLAY_TIME_MINUTES),
+    MENU_ENTRY(BACK, OPEN_MENU, MenuItem::MAIN),
+};
+
+// hidden page, not linked from the main menu, the diagnostic entries show their live value after their label
+static const MenuEntry diagnosticsMenuEntries[] PROGMEM = {
+    MENU_ENTRY(DIAGNOSTICS_TITLE, NONE, 0),
+    MENU_ENTRY(DIAGNOSTIC_LOOPS_PER_SECOND, SHOW_DIAGNOSTIC, DIAGNOSTIC_LOOPS_PER_SECOND),
+    MENU_ENTRY(DIAGNOSTIC_WORST_LOOP_MICROS, SHOW_DIAGNOSTIC, DIAGNOSTIC_WORST_LOOP_MICROS),
+    MENU_ENTRY(DIAGNOSTIC_TICK_JITTER, SHOW_DIAGNOSTIC, DIAGNOSTIC_TICK_JITTER),
+    MENU_ENTRY(DIAGNOSTIC_LATE_TICKS, SHOW_DIAGNOSTIC, DIAGNOSTIC_LATE_TICKS),
+    MENU_ENTRY(DIAGNOSTIC_SKIPPED_TICKS, SHOW_DIAGNOSTIC, DIAGNOSTIC_SKIPPED_TICKS),
+    MENU_ENTRY(DIAGNOSTIC_FREE_MEMORY, SHOW_DIAGNOSTIC, DIAGNOSTIC_FREE_MEMORY),
+    MENU_ENTRY(DIAGNOSTIC_MIN_FREE_MEMORY, SHOW_DIAGNOSTIC, DIAGNOSTIC_MIN_FREE_MEMORY),
+    MENU_ENTRY(DIAGNOSTIC_STACK_PEAK, SHOW_DIAGNOSTIC, DIAGNOSTIC_STACK_PEAK),
+    MENU_ENTRY(DIAGNOSTIC_LCD_BYTES_PER_SECOND, SHOW_DIAGNOSTIC, DIAGNOSTIC_LCD_BYTES_PER_SECOND),
+    MENU_ENTRY(DIAGNOSTIC_MATRIX_BYTES_PER_SECOND, SHOW_DIAGNOSTIC, DIAGNOSTIC_MATRIX_BYTES_PER_SECOND),
+    MENU_ENTRY(BACK, OPEN_MENU, MenuItem::MAIN),
+};
+
+static const MenuEntry howToPlayMenuEntries[] PROGMEM = {
+    MENU_ENTRY(HOW_TO_PLAY_TITLE, NONE, 0),
+    MENU_ENTRY(HOW_TO_PLAY_RULES, NONE, 0),
+    MENU_ENTRY(BACK, OPEN_MENU, MenuItem::MAIN),
+};
+
+// pages indexed by MenuItem, the play page has no entries since the menu hides while the game is played
+static const MenuPage menuPages[] PROGMEM = {
+    {mainMenuEntries, sizeof(mainMenuEntries) / sizeof(MenuEntry), SNAKE_ICON},
+    {nullptr, 0, PLAY_ICON},
+    {highscoresMenuEntries, sizeof(highscoresMenuEntries) / sizeof(MenuEntry), HIGHSCORE_ICON},
+    {settingsMenuEntries, sizeof(settingsMenuEntries) / sizeof(MenuEntry), SETTINGS_ICON},
+    {aboutMenuEntries, sizeof(aboutMenuEntries) / sizeof(MenuEntry), ABOUT_ME_ICON},
+    {howToPlayMenuEntries, sizeof(howToPlayMenuEntries) / sizeof(MenuEntry), QUESTION_MARK_ICON},
+    {statsMenuEntries, sizeof(statsMenuEntries) / sizeof(MenuEntry), STATS_ICON},
+    {diagnosticsMenuEntries, sizeof(diagnosticsMenuEntries) / sizeof(MenuEntry), DIAGNOSTICS_ICON},
+};
+
+#endif
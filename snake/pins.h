@@ -0,0 +1,52 @@
+/**
+ * File containing functions to access the ATmega328P arduino pins through their port registers, with the port and bit
+ * mask of a pin resolved at compile time when the pin is a constant. Supported pins: 0-7 on PORTD, 8-13 on PORTB and
+ * A0-A5 on PORTC
+ */
+
+#ifndef PINS_H
+#define PINS_H
+
+/**
+ * Function that resolves at compile time the port of an arduino pin: 0 for PORTD, 1 for PORTB and 2 for PORTC
+ * @param pin - the arduino pin
+ * @return the port index
+ */
+constexpr byte getPinPortIndex(const byte pin) {
+  return pin < 8 ? 0 : (pin < 14 ? 1 : 2);
+}
+
+/**
+ * Function that resolves at compile time the bit mask of an arduino pin in its port
+ * @param pin - the arduino pin
+ * @return the bit mask
+ */
+constexpr byte getPinBitMask(const byte pin) {
+  return 1 << (pin < 8 ? pin : (pin < 14 ? pin - 8 : pin - 14));
+}
+
+/**
+ * Function that returns the output register of an arduino pin's port, folded into a constant address when the pin is
+ * known at compile time
+ * @param pin - the arduino pin
+ * @return reference to the port output register
+ */
+inline volatile byte &getPinPortRegister(const byte pin) {
+  return getPinPortIndex(pin) == 0 ? PORTD : (getPinPortIndex(pin) == 1 ? PORTB : PORTC);
+}
+
+/**
+ * Function that sets the state of a pin through its port register, a single instruction when the pin is a constant
+ * @param pin - the arduino pin
+ * @param state - the state to set the pin to
+ * No @return
+ */
+inline void writePinFast(const byte pin, const bool state) {
+  if (state) {
+    getPinPortRegister(pin) |= getPinBitMask(pin);
+  } else {
+    getPinPortRegister(pin) &= ~getPinBitMask(pin);
+  }
+}
+
+#endif
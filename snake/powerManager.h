@@ -0,0 +1,109 @@
+/**
+ * File for the PowerManager class
+ * The PowerManager class is a singleton class that lowers the power used by the unit. Between two iterations of the
+ * main loop the MCU sleeps in the idle mode until the next interrupt: the Timer0 interrupt of millis() every ~1ms, the
+ * Serial or the sound interrupts, so the game's deadlines are still met within a millisecond. The MCU only stays awake
+ * while bytes are waiting to be sent to the LCD. When nothing changes on the screens, in the menu or in a paused game,
+ * and the joystick isn't touched for POWER_SAVE_TIMEOUT, the LCD backlight is dimmed and the matrix is shut down until
+ * the joystick is used again. The time the MCU is awake is measured as a duty cycle over POWER_DUTY_CYCLE_WINDOW
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include "config.h"
+#include "joystick.h"
+#include "lcd.h"
+#include "matrix.h"
+#include "utils.h"
+
+class PowerManager {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static PowerManager *getInstance() {
+    static PowerManager instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that enters or leaves the power saving of the screens and measures the duty cycle
+   * Needs to be called in a loop
+   * @param isScreenStatic - true if nothing changes on the screens without the joystick, like in the menu or in a
+   * paused game
+   * No @return
+   */
+  void update(const bool isScreenStatic) {
+    bool isInactive = isScreenStatic && millis() - joystick->getLastActivityTimestamp() >= POWER_SAVE_TIMEOUT;
+    if (isInactive != isPowerSaving) {
+      isPowerSaving = isInactive;
+      lcd->setIsDimmed(isPowerSaving);
+      lcMatrix->setIsShutdown(isPowerSaving);
+    }
+
+    unsigned long windowTime = millis() - windowStartTimestamp;
+    if (windowTime >= POWER_DUTY_CYCLE_WINDOW) {
+      dutyCyclePercent = 100 - min(sleptMicros / (windowTime * 10), 100UL);
+      sleptMicros = 0;
+      windowStartTimestamp = millis();
+    }
+  }
+
+  /**
+   * Function that puts the MCU to sleep until the next interrupt, unless bytes are waiting to be sent to the LCD
+   * No @params
+   * No @return
+   */
+  void sleep() {
+    if (!lcd->getIsQueueEmpty()) {
+      return;
+    }
+
+    unsigned long sleepStartTimestamp = micros();
+    sleepUntilNextInterrupt();
+    sleptMicros += micros() - sleepStartTimestamp;
+  }
+
+  /**
+   * Getter for the percentage of time the MCU was awake in the last POWER_DUTY_CYCLE_WINDOW
+   * No @params
+   * @return the duty cycle, from 0 to 100
+   */
+  byte getDutyCyclePercent() const {
+    return dutyCyclePercent;
+  }
+
+  bool getIsPowerSaving() const {
+    return isPowerSaving;
+  }
+
+private:
+  Joystick *joystick = nullptr;
+  LCD *lcd = nullptr;
+  Matrix *lcMatrix = nullptr;
+
+  bool isPowerSaving = false;
+  unsigned long windowStartTimestamp = 0;
+  unsigned long sleptMicros = 0; // time slept since the start of the duty cycle window
+  byte dutyCyclePercent = 100;
+
+  /**
+   * Private constructor for the singleton class
+   * The constructor will get the joystick to watch for activity and the screens to put in power saving
+   */
+  PowerManager() {
+    joystick = Joystick::getInstance();
+    lcd = LCD::getInstance();
+    lcMatrix = Matrix::getInstance();
+  }
+
+  PowerManager(const PowerManager &) = delete;
+
+  PowerManager &operator=(const PowerManager &) = delete;
+};
+
+#endif
@@ -0,0 +1,314 @@
+/**
+ * File for the Replay class
+ * The Replay class is a singleton class that records the seed of a game and the direction applied by the snake on each
+ * tick, so the game can be replayed exactly through the Game class with the joystick replaced by the log.
+ * Replays can be streamed out over a Serial stream and loaded back from it. There is no host build of the game, a
+ * replay is checked on the unit itself: the REPLAY line sent back over Serial is played at full speed and its
+ * REPLAY_RESULT line is compared with the original game's result.
+ * The log is run-length encoded on 4 bits per run of ticks moved in the same direction, 2 runs per byte. The snake
+ * can't turn back, so a run is a quarter turn left or right from the run before it, and can't move straight for more
+ * than MATRIX_SIZE ticks without hitting a wall, so a run holds a turn bit and the number of ticks (minus 1) on 3 bits.
+ * The direction of the first run is kept apart. The log holds REPLAY_MAX_RUNS runs: simulated games took about 2.5
+ * runs per food eaten, so the log holds a game filling the whole matrix. A longer game is recorded until the log is
+ * full and its replay is marked as truncated
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "config.h"
+#include "enums.h"
+#include "utils.h"
+
+// a run of the log: the turn from the run before it on bit 3, the number of ticks (minus 1) on bits 0-2
+#define REPLAY_RUN_RIGHT_TURN 0x08
+#define REPLAY_RUN_TICKS_MASK 0x07
+#define REPLAY_MAX_RUN_TICKS MATRIX_SIZE
+#define REPLAY_MAX_RUNS (REPLAY_LOG_SIZE * 2)
+
+static_assert(REPLAY_MAX_RUN_TICKS - 1 <= REPLAY_RUN_TICKS_MASK, "the ticks of a run fit on 3 bits");
+
+class Replay {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Replay *getInstance() {
+    static Replay instance;
+
+    return &instance;
+  }
+
+  /* getters for the replay data */
+  unsigned long getSeed() const {
+    return seed;
+  }
+
+  byte getGameDifficulty() const {
+    return gameDifficulty;
+  }
+
+  unsigned int getNumberOfTicks() const {
+    return numberOfTicks;
+  }
+
+  bool getIsTruncated() const {
+    return isTruncated;
+  }
+
+  Direction getFirstDirection() const {
+    return firstDirection;
+  }
+
+  unsigned int getNumberOfRuns() const {
+    return numberOfRuns;
+  }
+
+  /**
+   * Function that returns a byte of the log, holding 2 runs, the first one on the high 4 bits
+   * @param index - the index of the byte in the log, less than getLogSize()
+   * @return the byte of the log
+   */
+  byte getLogByte(const byte index) const {
+    return ticksLog[index];
+  }
+
+  /**
+   * Function that returns the number of bytes used by the runs of the log
+   * No @params
+   * @return the size of the log in bytes
+   */
+  byte getLogSize() const {
+    return (numberOfRuns + 1) / 2;
+  }
+
+  /**
+   * Function that clears the log and starts recording a new game
+   * @param seed - the seed of the game's random generator
+   * @param gameDifficulty - the difficulty level the game is played on
+   * No @return
+   */
+  void startRecording(const unsigned long seed, const byte gameDifficulty) {
+    this->seed = seed;
+    this->gameDifficulty = gameDifficulty;
+    numberOfTicks = 0;
+    numberOfRuns = 0;
+    isTruncated = false;
+  }
+
+  /**
+   * Function that records the direction applied by the snake on a tick, continuing the current run or starting a new
+   * one. When the log is full, or the direction can't be encoded, the recording stops and the replay is marked as
+   * truncated
+   * @param direction - the direction the snake moved in on the tick
+   * No @return
+   */
+  void recordTick(const Direction direction) {
+    if (isTruncated) {
+      return;
+    }
+
+    if (numberOfRuns > 0 && direction == runDirection &&
+        (getRunCode(numberOfRuns - 1) & REPLAY_RUN_TICKS_MASK) < REPLAY_MAX_RUN_TICKS - 1) { // continue the run
+      setRunCode(numberOfRuns - 1, getRunCode(numberOfRuns - 1) + 1);
+    } else if (numberOfRuns == 0) {
+      firstDirection = direction;
+      setRunCode(numberOfRuns++, 0);
+    } else if (numberOfRuns < REPLAY_MAX_RUNS && direction == getTurnedDirection(runDirection, 0)) {
+      setRunCode(numberOfRuns++, 0);
+    } else if (numberOfRuns < REPLAY_MAX_RUNS && direction == getTurnedDirection(runDirection, REPLAY_RUN_RIGHT_TURN)) {
+      setRunCode(numberOfRuns++, REPLAY_RUN_RIGHT_TURN);
+    } else {
+      isTruncated = true;
+      return;
+    }
+    runDirection = direction;
+    numberOfTicks++;
+  }
+
+  /**
+   * Function that rewinds the log to replay the recorded ticks from the start
+   * No @params
+   * No @return
+   */
+  void startPlayback() {
+    playbackRun = 0;
+    playbackRunTicks = 0;
+    runDirection = firstDirection;
+  }
+
+  /**
+   * Function that checks if there are recorded ticks left to be replayed
+   * No @params
+   * @return true if there are ticks left, false otherwise
+   */
+  bool hasNextTick() const {
+    return playbackRun < numberOfRuns;
+  }
+
+  /**
+   * Function that returns the direction applied on the next recorded tick and advances the playback
+   * Expected to be called only if hasNextTick() returns true
+   * No @params
+   * @return the direction the snake moved in on the tick
+   */
+  Direction getNextTick() {
+    byte runCode = getRunCode(playbackRun);
+    if (playbackRunTicks == 0 && playbackRun > 0) { // a new run turns from the run before it
+      runDirection = getTurnedDirection(runDirection, runCode);
+    }
+    playbackRunTicks++;
+    if (playbackRunTicks > (runCode & REPLAY_RUN_TICKS_MASK)) { // run ended, move to the next one
+      playbackRun++;
+      playbackRunTicks = 0;
+    }
+    return runDirection;
+  }
+
+  /**
+   * Function that computes the direction of a run from the direction of the run before it
+   * @param direction - the direction of the run before
+   * @param runCode - the run, its turn bit tells if it turns left or right
+   * @return the direction of the run
+   */
+  static Direction getTurnedDirection(const Direction direction, const byte runCode) {
+    // the directions are declared counterclockwise, a right turn goes 3 quarter turns counterclockwise
+    return Direction((byte(direction) + ((runCode & REPLAY_RUN_RIGHT_TURN) ? 3 : 1)) % 4);
+  }
+
+  /**
+   * Function that writes the replay as a single text line to a stream. The line has the format:
+   * REPLAY <seed in hex> <difficulty> <number of ticks> <truncated> <first direction> <number of runs> <log in hex>
+   * where truncated is 1 if the log got full and the game went on after the recorded ticks, 0 otherwise, and the log
+   * is written as getLogSize() bytes. The line can be sent back as is to be loaded with readFrom()
+   * @param stream - the stream to write the replay to
+   * No @return
+   */
+  void writeTo(Print &stream) const {
+    stream.print(F("REPLAY "));
+    stream.print(seed, HEX);
+    stream.print(' ');
+    stream.print(gameDifficulty);
+    stream.print(' ');
+    stream.print(numberOfTicks);
+    stream.print(' ');
+    stream.print(isTruncated);
+    stream.print(' ');
+    stream.print(byte(firstDirection));
+    stream.print(' ');
+    stream.print(numberOfRuns);
+    for (byte i = 0; i < getLogSize(); i++) {
+      stream.print(' ');
+      stream.print(ticksLog[i], HEX);
+    }
+    stream.println();
+  }
+
+  /**
+   * Function that loads a replay from a stream, reading the fields that follow the REPLAY keyword written by writeTo()
+   * The line is read and checked whole before it replaces the replay, so a malformed line keeps the last game's replay
+   * @param stream - the stream to read the replay from
+   * @return true if a valid replay was loaded, false otherwise
+   */
+  bool readFrom(Stream &stream) {
+    unsigned long readSeed, readDifficulty, readNumberOfTicks, readIsTruncated, readFirstDirection, readNumberOfRuns;
+    unsigned long value;
+    byte readLog[REPLAY_LOG_SIZE];
+    char token[6];
+
+    if (!readHexNumberFromStream(stream, readSeed) || readSeed == 0) {
+      return false;
+    }
+    if (!readTokenFromStream(stream, token, 1)) {
+      return false;
+    }
+    readDifficulty = atoi(token);
+    if (!readTokenFromStream(stream, token, 5)) {
+      return false;
+    }
+    readNumberOfTicks = atol(token);
+    if (!readTokenFromStream(stream, token, 1)) {
+      return false;
+    }
+    readIsTruncated = atoi(token);
+    if (!readTokenFromStream(stream, token, 1)) {
+      return false;
+    }
+    readFirstDirection = atoi(token);
+    if (!readTokenFromStream(stream, token, 3)) {
+      return false;
+    }
+    readNumberOfRuns = atoi(token);
+    if (readDifficulty < MIN_DIFFICULTY_LEVEL || readDifficulty > MAX_DIFFICULTY_LEVEL || readNumberOfTicks > 0xFFFF ||
+        readIsTruncated > 1 || readFirstDirection > byte(Direction::RIGHT) || readNumberOfRuns > REPLAY_MAX_RUNS) {
+      return false;
+    }
+
+    for (byte i = 0; i < (readNumberOfRuns + 1) / 2; i++) {
+      if (!readHexNumberFromStream(stream, value) || value > 0xFF) {
+        return false;
+      }
+      readLog[i] = value;
+    }
+
+    seed = readSeed;
+    gameDifficulty = readDifficulty;
+    numberOfTicks = readNumberOfTicks;
+    isTruncated = readIsTruncated;
+    firstDirection = Direction(readFirstDirection);
+    numberOfRuns = readNumberOfRuns;
+    memcpy(ticksLog, readLog, getLogSize());
+    return true;
+  }
+
+private:
+  unsigned long seed = 1;
+  byte gameDifficulty = MIN_DIFFICULTY_LEVEL;
+  unsigned int numberOfTicks = 0;
+  bool isTruncated = false;
+
+  // run-length encoded log of the directions applied on each tick
+  Direction firstDirection = Direction::RIGHT;
+  byte ticksLog[REPLAY_LOG_SIZE];
+  unsigned int numberOfRuns = 0;
+
+  // direction of the last run recorded or of the run played back
+  Direction runDirection = Direction::RIGHT;
+
+  // playback position in the log
+  unsigned int playbackRun = 0;
+  byte playbackRunTicks = 0;
+
+  /**
+   * Private constructor for the singleton class
+   */
+  Replay() {}
+
+  Replay(const Replay &) = delete;
+
+  Replay &operator=(const Replay &) = delete;
+
+  /**
+   * Function that returns a run of the log
+   * @param index - the index of the run
+   * @return the run, on the 4 low bits
+   */
+  byte getRunCode(const unsigned int index) const {
+    return index % 2 == 0 ? ticksLog[index / 2] >> 4 : ticksLog[index / 2] & 0x0F;
+  }
+
+  /**
+   * Function that sets a run of the log, keeping the other run of its byte
+   * @param index - the index of the run
+   * @param runCode - the run, on the 4 low bits
+   * No @return
+   */
+  void setRunCode(const unsigned int index, const byte runCode) {
+    byte &logByte = ticksLog[index / 2];
+    logByte = index % 2 == 0 ? (logByte & 0x0F) | (runCode << 4) : (logByte & 0xF0) | runCode;
+  }
+};
+
+#endif
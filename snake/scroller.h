@@ -0,0 +1,164 @@
+/**
+ * File for the Scroller class
+ * The Scroller class holds the state of a scrolling region of the LCD: the row, column and width of the region and a
+ * window over a message, either a string from the RAM or a packed UI string. The message is never copied, the window
+ * reads the characters straight from the message, followed by a gap of spaces before the message starts again, so a
+ * scroller doesn't allocate any memory and many scrollers can run at the same time. A UI string is decoded as a stream:
+ * the scroller keeps a reader at the start of the window and decodes only the characters of the window
+ */
+
+#ifndef SCROLLER_H
+#define SCROLLER_H
+
+#include "config.h"
+#include "uiStringReader.h"
+
+class Scroller {
+public:
+  /**
+   * Function that starts scrolling a message from the RAM from its start
+   * @param newMessage - pointer to the message to scroll, must stay valid while scrolling
+   * @param newCol - the column where the region starts
+   * @param newRow - the row of the region
+   * @param newWidth - the number of characters of the region
+   * No @return
+   */
+  void start(const char *newMessage, const byte newCol, const byte newRow, const byte newWidth) {
+    message = newMessage;
+    messageLength = strlen(message);
+    startRegion(newCol, newRow, newWidth);
+  }
+
+  /**
+   * Function that starts scrolling a UI string from its start
+   * @param newStringId - the id of the UI string to scroll
+   * @param newCol - the column where the region starts
+   * @param newRow - the row of the region
+   * @param newWidth - the number of characters of the region
+   * No @return
+   */
+  void start(const UiStringId newStringId, const byte newCol, const byte newRow, const byte newWidth) {
+    message = nullptr;
+    stringId = newStringId;
+    messageLength = getUiStringLength(stringId);
+    reader.open(stringId);
+    startRegion(newCol, newRow, newWidth);
+  }
+
+  /**
+   * Function that stops the scrolling, the characters of the region are left on the LCD
+   * No @params
+   * No @return
+   */
+  void stop() {
+    isActive = false;
+  }
+
+  /**
+   * Function that checks if the scroller has a message to scroll
+   * No @params
+   * @return true if the scroller is active, false otherwise
+   */
+  bool getIsActive() const {
+    return isActive;
+  }
+
+  /**
+   * Function that moves the window one character further when PRINT_MESSAGE_SCROLL_DELAY passed since the last move
+   * No @params
+   * @return true if the window moved and the region needs to be redrawn, false otherwise
+   */
+  bool step() {
+    if (!isActive || millis() - lastScrollTime < PRINT_MESSAGE_SCROLL_DELAY) {
+      return false;
+    }
+
+    lastScrollTime = millis();
+    if (offset < messageLength && !message) { // move the reader past the character leaving the window
+      reader.next();
+    }
+    offset++;
+    if (offset == messageLength + LCD_SCROLL_GAP_LENGTH) { // the window looped back to the message start
+      offset = 0;
+      if (!message) {
+        reader.open(stringId);
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Function that starts reading the window from its first character
+   * No @params
+   * No @return
+   */
+  void beginWindow() {
+    windowIndex = offset;
+    windowReader = reader;
+  }
+
+  /**
+   * Function that returns the next character of the window, the gap after the message is made of spaces
+   * No @params
+   * @return the character
+   */
+  char nextWindowChar() {
+    char c = ' ';
+    if (windowIndex < messageLength) {
+      c = message ? message[windowIndex] : windowReader.next();
+    }
+
+    windowIndex++;
+    if (windowIndex == messageLength + LCD_SCROLL_GAP_LENGTH) { // the window continues with the message start
+      windowIndex = 0;
+      windowReader.open(stringId);
+    }
+    return c;
+  }
+
+  byte getCol() const {
+    return col;
+  }
+
+  byte getRow() const {
+    return row;
+  }
+
+  byte getWidth() const {
+    return width;
+  }
+
+private:
+  bool isActive = false;
+  const char *message = nullptr; // message from the RAM, nullptr when scrolling a UI string
+  UiStringId stringId = UiStringId(0);
+  unsigned int messageLength = 0;
+  unsigned int offset = 0;
+  unsigned long lastScrollTime = 0;
+  byte col = 0;
+  byte row = 0;
+  byte width = 0;
+
+  // reader of the UI string at the window start and reader of the window being printed
+  UiStringReader reader;
+  UiStringReader windowReader;
+  unsigned int windowIndex = 0;
+
+  /**
+   * Function that places the region and starts the scrolling with the window at the message start
+   * @param newCol - the column where the region starts
+   * @param newRow - the row of the region
+   * @param newWidth - the number of characters of the region
+   * No @return
+   */
+  void startRegion(const byte newCol, const byte newRow, const byte newWidth) {
+    col = newCol;
+    row = newRow;
+    width = newWidth;
+    offset = 0;
+    lastScrollTime = millis();
+    isActive = true;
+  }
+};
+
+#endif
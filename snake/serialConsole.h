@@ -0,0 +1,99 @@
+/**
+ * File for the SerialConsole class
+ * The SerialConsole class is a singleton class that reads commands sent over Serial while the menu is shown. Commands:
+ * - REPLAY <replay data> - loads a replay written by the game and requests it to be played
+ * - DUMP - writes the replay of the last game played
+ * - STATS - writes the lifetime statistics
+ * - POWER - writes the awake duty cycle in percents and if the screens are in power saving
+ * - MEMORY - writes the free memory, the lowest free memory since boot and the stack's peak size
+ * - TICKS - writes the snake's ticks late and skipped since boot and the worst lateness of the last game
+ */
+
+#ifndef SERIAL_CONSOLE_H
+#define SERIAL_CONSOLE_H
+
+#include "config.h"
+#include "utils.h"
+#include "replay.h"
+#include "stats.h"
+#include "powerManager.h"
+#include "diagnostics.h"
+
+class SerialConsole {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static SerialConsole *getInstance() {
+    static SerialConsole instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that reads and runs a command if one was sent over Serial
+   * Needs to be called in a loop, returns immediately if nothing was sent
+   * No @params
+   * @return true if a replay was loaded and requested to be played, false otherwise
+   */
+  bool update() {
+    if (!Serial.available()) {
+      return false;
+    }
+
+    bool isReplayRequested = false;
+    char command[SERIAL_COMMAND_MAX_LENGTH + 1];
+    if (readTokenFromStream(Serial, command, SERIAL_COMMAND_MAX_LENGTH)) {
+      if (strcmp_P(command, PSTR("REPLAY")) == 0) {
+        isReplayRequested = replay->readFrom(Serial);
+        if (!isReplayRequested) {
+          Serial.println(F("ERROR invalid replay"));
+        }
+      } else if (strcmp_P(command, PSTR("DUMP")) == 0) {
+        replay->writeTo(Serial);
+      } else if (strcmp_P(command, PSTR("STATS")) == 0) {
+        stats->writeTo(Serial);
+      } else if (strcmp_P(command, PSTR("POWER")) == 0) {
+        Serial.print(F("POWER "));
+        Serial.print(powerManager->getDutyCyclePercent());
+        Serial.print(' ');
+        Serial.println(powerManager->getIsPowerSaving());
+      } else if (strcmp_P(command, PSTR("MEMORY")) == 0) {
+        diagnostics->writeTo(Serial);
+      } else if (strcmp_P(command, PSTR("TICKS")) == 0) {
+        diagnostics->writeTicksTo(Serial);
+      } else {
+        Serial.println(F("ERROR unknown command"));
+      }
+    }
+    skipLineFromStream(Serial);
+
+    return isReplayRequested;
+  }
+
+private:
+  Replay *replay = nullptr;
+  Stats *stats = nullptr;
+  PowerManager *powerManager = nullptr;
+  Diagnostics *diagnostics = nullptr;
+
+  /**
+   * Private constructor for the singleton class
+   * The constructor will get the replay to load and dump the games' replays, the stats, the power manager and the
+   * diagnostics to dump
+   */
+  SerialConsole() {
+    replay = Replay::getInstance();
+    stats = Stats::getInstance();
+    powerManager = PowerManager::getInstance();
+    diagnostics = Diagnostics::getInstance();
+  }
+
+  SerialConsole(const SerialConsole &) = delete;
+
+  SerialConsole &operator=(const SerialConsole &) = delete;
+};
+
+#endif
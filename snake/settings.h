@@ -1,19 +1,19 @@
 /**
  * File for the Settings class
  * The Settings class is a singleton class that allows access to the settings data of the game,
- * save/load to/from storage
+ * save/load to/from storage, with the default settings used when no valid settings are saved
  */
 
 #ifndef SETTINGS_H
 #define SETTINGS_H
 
-#include <EEPROM.h>
+#include "storage.h"
 
 class Settings {
 public:
   /**
    * struct for settings data for easier access to the data, and passing it around
-   * it allows for easier access to the data in the EEPROM
+   * it allows for easier access to the data in the storage
    */
   struct SettingsData {
     byte lcdContrast;
@@ -24,24 +24,17 @@ public:
     char playerName[MAX_PLAYER_NAME_LENGTH + 1];
   };
 
+  static_assert(sizeof(SettingsData) <= SETTINGS_RECORD_CAPACITY, "the settings data don't fit in their record");
+
   /**
    * Static method to get a pointer to the instance of the class
    * No @params
    * @return pointer to the instance of the class
    */
   static Settings *getInstance() {
-    static Settings *instance = new Settings();
-
-    return instance;
-  }
+    static Settings instance;
 
-  /**
-   * Function that returns the size needed to save the settings data
-   * No @params
-   * @return size of the settings data
-   */
-  static unsigned int sizeOfSettingsData() {
-    return sizeof(settingsData);
+    return &instance;
   }
 
   /* getters for the settings data */
@@ -95,23 +88,23 @@ public:
   }
 
   /**
-   * Function that loads the settings from the EEPROM
-   * The settings data are saved in EEPROM at offset 0
+   * Function that loads the settings from the storage, the default settings are used if no valid settings are saved
    * No @params
    * No @return
    */
   void loadFromStorage() {
-    EEPROM.get(SETTINGS_OFFSET_IN_STORAGE, settingsData);
+    if (!Storage::getInstance()->load(StorageRecord::SETTINGS, settingsData)) {
+      setDefaults();
+    }
   }
 
   /**
-   * Function that saves the settings data in the EEPROM
-   * The settings data are saved in EEPROM at offset 0
+   * Function that saves the settings data in the storage
    * No @params
    * No @return
    */
   void saveInStorage() {
-    EEPROM.put(SETTINGS_OFFSET_IN_STORAGE, settingsData);
+    Storage::getInstance()->save(StorageRecord::SETTINGS, settingsData);
   }
 
 private:
@@ -128,6 +121,20 @@ private:
   Settings(const Settings &other) = delete;
 
   Settings &operator=(const Settings &) = delete;
+
+  /**
+   * Function that sets the default settings: the sliders at half, the sound on and the default player name
+   * No @params
+   * No @return
+   */
+  void setDefaults() {
+    setLcdContrast(MAX_LCD_CONTRAST_BLOCK_COUNT / 2);
+    setLcdBrightness(MAX_LCD_BRIGHTNESS_BLOCK_COUNT / 2);
+    setMatrixBrightness(MAX_MATRIX_BRIGHTNESS_BLOCK_COUNT / 2);
+    setGameDifficulty(MAX_DIFFICULTY_BLOCK_COUNT / 2);
+    setIsSoundOn(true);
+    setPlayerName("NO 0NE");
+  }
 };
 
 #endif
\ No newline at end of file
@@ -5,32 +5,79 @@
 #include "game.h"
 #include "menu.h"
 #include "utils.h"
+#include "serialConsole.h"
+#include "powerManager.h"
+#include "diagnostics.h"
+#include "watchdog.h"
+
+// every object lives in a static instance, none is allocated on the heap, so their size is known at build time
+// this is a partial check of the singletons only: their guard variables, the Serial buffers, the synth voices, the
+// file scope arrays and the stack aren't counted. The whole .data + .bss is given by avr-size on the built elf and
+// the stack headroom left at run time by the diagnostics page. The sizes are the target's, so it's checked on AVR only
+#ifdef __AVR__
+static_assert(sizeof(Game) + sizeof(Menu) + sizeof(LCD) + sizeof(Matrix) + sizeof(Joystick) + sizeof(SoundDevice) +
+                  sizeof(Synth) + sizeof(Settings) + sizeof(Highscores) + sizeof(Stats) + sizeof(Snapshot) +
+                  sizeof(Storage) + sizeof(Replay) + sizeof(Ghost) + sizeof(SerialConsole) + sizeof(PowerManager) +
+                  sizeof(Diagnostics) + sizeof(Watchdog) <= SINGLETONS_SRAM_BUDGET,
+              "the singletons don't fit in their sram budget");
+#endif
 
 Game *game = nullptr;
 Menu *menu = nullptr;
+LCD *lcd = nullptr;
+Matrix *lcMatrix = nullptr;
+SerialConsole *serialConsole = nullptr;
+PowerManager *powerManager = nullptr;
+Diagnostics *diagnostics = nullptr;
+Watchdog *watchdog = nullptr;
 bool playingGame = false;
 bool startGameIntro = true;
 
 void setup() {
   Serial.begin(9600);
 
-  // uncomment before first run to have default values saved in storage for the settings and highscores data
-  // and not get garbage info
-//  initDefaultDataInStorage();
-
   menu = Menu::getInstance();
   game = Game::getInstance();
+  lcd = LCD::getInstance();
+  lcMatrix = Matrix::getInstance();
+  serialConsole = SerialConsole::getInstance();
+  powerManager = PowerManager::getInstance();
+  diagnostics = Diagnostics::getInstance();
+  watchdog = Watchdog::getInstance();
+
+  if (watchdog->getWasStalled()) { // the loop stalled before the reset, skip the intro and start in the main menu
+    startGameIntro = false;
+    menu->resetMenu();
+  }
+  watchdog->start();
 }
 
 void loop() {
+  feedWatchdog();
+
   if (startGameIntro) {
     startGameIntro = menu->showStartMessage();
   } else if (!playingGame) {
     playingGame = menu->loadMenu();
+    if (playingGame && menu->getIsContinueRequested()) { // the saved game was chosen to be continued
+      game->startResume();
+    }
+    if (!playingGame && serialConsole->update()) { // a replay was sent to be played
+      game->startReplay();
+      playingGame = true;
+    }
   } else {
     playingGame = game->play();
     if (!playingGame) {
       menu->resetMenu();
     }
   }
+
+  lcd->update(); // send to the lcd a part of what was printed
+  lcMatrix->update(); // send to the matrix the rows changed
+  diagnostics->update(); // track the stack's high-water mark
+
+  // the screens are static in the menu and in a paused game, sleep until the next interrupt
+  powerManager->update(!startGameIntro && (!playingGame || game->getIsPaused()));
+  powerManager->sleep();
 }
@@ -0,0 +1,186 @@
+/**
+ * File for the Snapshot class
+ * The Snapshot class is a singleton class that saves the state of a game in progress in the storage, so the game can
+ * be continued later, even after a power cycle. The snapshot is compact: the snake's body is saved as the head position
+ * and a chain of 2-bit directions going from the head to the tail, instead of the whole game matrix. The encoding and
+ * the decoding only walk the snake's body once, so saving a snapshot takes a few microseconds plus the EEPROM writes
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "config.h"
+#include "enums.h"
+#include "point2D.h"
+#include "storage.h"
+
+#define SNAPSHOT_BODY_CHAIN_SIZE ((MAX_SNAKE_LENGTH - 1 + 3) / 4)
+#define SNAPSHOT_NO_FOOD 0xFF
+
+class Snapshot {
+public:
+  /**
+   * struct for the state of a game in progress for easier access to the data, and passing it around
+   * it allows for easier access to the data in the storage
+   */
+  struct SnapshotData {
+    uint32_t randomState;
+    uint32_t gameClock;
+    uint16_t timeSinceLastEat;
+    byte head; // packed with packPoint
+    byte food; // packed with packPoint, SNAPSHOT_NO_FOOD if the food wasn't generated yet
+    byte snakeLength;
+    byte snakeNumberOfLives;
+    byte gameDifficulty;
+    byte snakeDirection;
+    byte bodyChain[SNAPSHOT_BODY_CHAIN_SIZE]; // direction from each segment to the next one, 4 directions per byte
+  };
+
+  static_assert(sizeof(SnapshotData) <= SNAPSHOT_RECORD_CAPACITY, "the snapshot data don't fit in their record");
+  static_assert(STARVING_TIME_INTERVAL <= 0xFFFF, "the time since the last eat doesn't fit in the snapshot");
+
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Snapshot *getInstance() {
+    static Snapshot instance;
+
+    return &instance;
+  }
+
+  bool getIsSaved() const {
+    return isSaved;
+  }
+
+  /**
+   * Function that saves a snapshot in the storage, replacing the previous one
+   * @param snapshotData - the snapshot
+   * No @return
+   */
+  void save(const SnapshotData &snapshotData) {
+    Storage::getInstance()->save(StorageRecord::SNAPSHOT, snapshotData);
+    isSaved = true;
+  }
+
+  /**
+   * Function that loads the saved snapshot from the storage
+   * @param snapshotData - the variable the snapshot is loaded in
+   * @return true if a valid snapshot was loaded, false otherwise
+   */
+  bool load(SnapshotData &snapshotData) {
+    return Storage::getInstance()->load(StorageRecord::SNAPSHOT, snapshotData);
+  }
+
+  /**
+   * Function that erases the saved snapshot, so a game is continued only once
+   * No @params
+   * No @return
+   */
+  void erase() {
+    Storage::getInstance()->erase<SnapshotData>(StorageRecord::SNAPSHOT);
+    isSaved = false;
+  }
+
+  /**
+   * Function that encodes the snake's body from the game matrix as a chain of directions. Each segment of the body has
+   * in the game matrix a value one less than the segment before it, starting from the snake length at the head, so the
+   * next segment is the neighbour with the value one less
+   * @param gameMatrix - the game matrix
+   * @param head - the position of the snake's head, inside the matrix
+   * @param snakeLength - the length of the snake
+   * @param bodyChain - the chain of the snapshot
+   * No @return
+   */
+  static void encodeBody(const byte gameMatrix[MATRIX_SIZE][MATRIX_SIZE], Point2D head, const byte snakeLength,
+                         byte bodyChain[SNAPSHOT_BODY_CHAIN_SIZE]) {
+    memset(bodyChain, 0, SNAPSHOT_BODY_CHAIN_SIZE);
+    for (byte i = 0; i < snakeLength - 1; i++) {
+      byte direction = 0;
+      for (; direction < 4; direction++) {
+        Point2D next = moveInDirection(head, Direction(direction));
+        if (next.x < MATRIX_SIZE && next.y < MATRIX_SIZE && gameMatrix[next.x][next.y] == snakeLength - 1 - i) {
+          head = next;
+          break;
+        }
+      }
+      bodyChain[i >> 2] |= (direction & 0x03) << ((i & 0x03) << 1);
+    }
+  }
+
+  /**
+   * Function that decodes the snake's body from a chain of directions in the game matrix, following the chain from the
+   * head and giving each segment a value one less than the segment before it
+   * @param gameMatrix - the game matrix, cleared
+   * @param head - the position of the snake's head
+   * @param snakeLength - the length of the snake
+   * @param bodyChain - the chain of the snapshot
+   * No @return
+   */
+  static void decodeBody(byte gameMatrix[MATRIX_SIZE][MATRIX_SIZE], Point2D head, const byte snakeLength,
+                         const byte bodyChain[SNAPSHOT_BODY_CHAIN_SIZE]) {
+    gameMatrix[head.x][head.y] = snakeLength;
+    for (byte i = 0; i < snakeLength - 1; i++) {
+      head = moveInDirection(head, Direction((bodyChain[i >> 2] >> ((i & 0x03) << 1)) & 0x03));
+      if (head.x >= MATRIX_SIZE || head.y >= MATRIX_SIZE) {
+        return;
+      }
+      gameMatrix[head.x][head.y] = snakeLength - 1 - i;
+    }
+  }
+
+  /**
+   * Function that packs a position of the matrix in a byte, the row on the high nibble and the column on the low one
+   * @param point - the position
+   * @return the position packed
+   */
+  static byte packPoint(const Point2D &point) {
+    return (point.x << 4) | (point.y & 0x0F);
+  }
+
+  static Point2D unpackPoint(const byte packedPoint) {
+    return {byte(packedPoint >> 4), byte(packedPoint & 0x0F)};
+  }
+
+private:
+  bool isSaved = false;
+
+  /**
+   * Private constructor for the singleton class
+   * The constructor will check if a snapshot is saved in the storage
+   */
+  Snapshot() {
+    isSaved = Storage::getInstance()->isSaved<SnapshotData>(StorageRecord::SNAPSHOT);
+  }
+
+  Snapshot(const Snapshot &) = delete;
+
+  Snapshot &operator=(const Snapshot &) = delete;
+
+  /**
+   * Function that moves a position of the matrix one cell in a direction, the same way the snake's head moves
+   * @param point - the position
+   * @param direction - the direction
+   * @return the new position, a position moved outside the matrix wraps to a value at least MATRIX_SIZE
+   */
+  static Point2D moveInDirection(Point2D point, const Direction direction) {
+    switch (direction) {
+      case Direction::UP:
+        point.x--;
+        break;
+      case Direction::LEFT:
+        point.y--;
+        break;
+      case Direction::DOWN:
+        point.x++;
+        break;
+      case Direction::RIGHT:
+        point.y++;
+        break;
+    }
+    return point;
+  }
+};
+
+#endif
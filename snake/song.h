@@ -1,28 +1,97 @@
 /**
- * File that contains the definition for the theme song of the old Nokia phones
- * credits to https://github.com/robsoncouto/arduino-songs/blob/master/nokia/nokia.ino
- * for melody transcript
+ * File that contains the songs of the game saved in the Flash memory in a compact format:
+ * - each note is packed into a single byte: the duration code on the 3 high bits and the note's pitch code on the 5
+ * low bits. The pitch code is the number of semitones above the track's base note + 1, 0 being a rest
+ * - each track has a header with the tempo, the base note, if the track loops and the number of notes
+ * Credits to https://github.com/robsoncouto/arduino-songs/blob/master/nokia/nokia.ino for the theme song of the old
+ * Nokia phones melody transcript
  */
 
 #ifndef SONG_H
 #define SONG_H
 
-#include "pitches.h"
-
-// save notes of the melody followed by the duration
-// 4 = quarter note, 8 = eighteenth, 16 sixteenth & so on
-// negative numbers represent a dotted note
-// ex: -4 is a dotted quarter note, meaning a quarter + an eighteenth
-int melody[] = {
-    NOTE_E5, 8, NOTE_D5, 8, NOTE_FS4, 4, NOTE_GS4, 4,
-    NOTE_CS5, 8, NOTE_B4, 8, NOTE_D4, 4, NOTE_E4, 4,
-    NOTE_B4, 8, NOTE_A4, 8, NOTE_CS4, 4, NOTE_E4, 4,
-    NOTE_A4, 2, REST, 4, REST, 4
+// semitones of an octave
+#define SEMITONE_C 0
+#define SEMITONE_CS 1
+#define SEMITONE_D 2
+#define SEMITONE_DS 3
+#define SEMITONE_E 4
+#define SEMITONE_F 5
+#define SEMITONE_FS 6
+#define SEMITONE_G 7
+#define SEMITONE_GS 8
+#define SEMITONE_A 9
+#define SEMITONE_AS 10
+#define SEMITONE_B 11
+#define SEMITONES_PER_OCTAVE 12
+#define HIGHEST_OCTAVE 8
+
+// note index counted in semitones from C0
+#define NOTE_INDEX(semitone, octave) ((octave) * SEMITONES_PER_OCTAVE + (semitone))
+
+// duration codes, the dotted notes last one half more than the regular ones
+#define DURATION_WHOLE 0
+#define DURATION_HALF 1
+#define DURATION_QUARTER 2
+#define DURATION_EIGHTH 3
+#define DURATION_SIXTEENTH 4
+#define DURATION_DOTTED_HALF 5
+#define DURATION_DOTTED_QUARTER 6
+#define DURATION_DOTTED_EIGHTH 7
+#define FIRST_DOTTED_DURATION DURATION_DOTTED_HALF
+
+// pack a note relative to the SONG_BASE_NOTE defined before each track
+#define SONG_NOTE(noteIndex, duration) byte(((duration) << 5) | ((noteIndex) - SONG_BASE_NOTE + 1))
+#define SONG_REST(duration) byte((duration) << 5)
+
+// tracks of the game
+#define TRACK_INTRO 0
+#define TRACK_GAME 1
+#define TRACK_GAME_OVER 2
+
+/**
+ * struct for a track header saved in the Flash memory
+ */
+struct SongTrack {
+  byte tempo;
+  byte baseNote;
+  bool isLooping;
+  byte numberOfNotes;
+  const byte *notes;
 };
 
-#define SONG_TEMPO 180
-#define WHOLE_NOTE_DURATION (int)((60000 * 4) / SONG_TEMPO)
+// frequencies of the notes of the highest octave, the lower octaves are obtained by halving them
+static const unsigned int highestOctaveFrequencies[SEMITONES_PER_OCTAVE] PROGMEM = {
+    4186, 4435, 4699, 4978, 5274, 5588, 5920, 6272, 6645, 7040, 7459, 7902
+};
+
+// dividers of the whole note for each duration code
+static const byte durationDividers[] PROGMEM = {1, 2, 4, 8, 16, 2, 4, 8};
+
+#define SONG_BASE_NOTE NOTE_INDEX(SEMITONE_C, 4)
+static const byte nokiaThemeNotes[] PROGMEM = {
+    SONG_NOTE(NOTE_INDEX(SEMITONE_E, 5), DURATION_EIGHTH), SONG_NOTE(NOTE_INDEX(SEMITONE_D, 5), DURATION_EIGHTH),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_FS, 4), DURATION_QUARTER), SONG_NOTE(NOTE_INDEX(SEMITONE_GS, 4), DURATION_QUARTER),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_CS, 5), DURATION_EIGHTH), SONG_NOTE(NOTE_INDEX(SEMITONE_B, 4), DURATION_EIGHTH),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_D, 4), DURATION_QUARTER), SONG_NOTE(NOTE_INDEX(SEMITONE_E, 4), DURATION_QUARTER),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_B, 4), DURATION_EIGHTH), SONG_NOTE(NOTE_INDEX(SEMITONE_A, 4), DURATION_EIGHTH),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_CS, 4), DURATION_QUARTER), SONG_NOTE(NOTE_INDEX(SEMITONE_E, 4), DURATION_QUARTER),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_A, 4), DURATION_HALF), SONG_REST(DURATION_QUARTER), SONG_REST(DURATION_QUARTER)
+};
+#undef SONG_BASE_NOTE
 
-const int NUMBER_OF_NOTES = sizeof(melody) / sizeof(melody[0]) / 2;
+#define SONG_BASE_NOTE NOTE_INDEX(SEMITONE_C, 4)
+static const byte gameOverNotes[] PROGMEM = {
+    SONG_NOTE(NOTE_INDEX(SEMITONE_G, 4), DURATION_EIGHTH), SONG_NOTE(NOTE_INDEX(SEMITONE_FS, 4), DURATION_EIGHTH),
+    SONG_NOTE(NOTE_INDEX(SEMITONE_F, 4), DURATION_EIGHTH), SONG_NOTE(NOTE_INDEX(SEMITONE_E, 4), DURATION_DOTTED_HALF)
+};
+#undef SONG_BASE_NOTE
+
+// the in-game track plays the theme song slower, to stay in the background
+static const SongTrack songTracks[] PROGMEM = {
+    {180, NOTE_INDEX(SEMITONE_C, 4), true, sizeof(nokiaThemeNotes), nokiaThemeNotes},
+    {140, NOTE_INDEX(SEMITONE_C, 4), true, sizeof(nokiaThemeNotes), nokiaThemeNotes},
+    {120, NOTE_INDEX(SEMITONE_C, 4), false, sizeof(gameOverNotes), gameOverNotes},
+};
 
-#endif
\ No newline at end of file
+#endif
@@ -2,6 +2,10 @@
  * File for the Sound device class
  * The SoundDevice class is a singleton class that allows control to a sound output device,
  * controls the play of its audio and have the capability to play songs
+ * The sound is synthesized by the Synth engine: the song plays on the music voice and the sound effects on the other
+ * voices, mixed together, so an effect doesn't interrupt the song. When all the effect voices are busy a new effect
+ * takes over the one closest to its end, the music voice is never taken by an effect.
+ * All the sound output goes through this class, nothing else should drive the sound device pin
  */
 
 #ifndef SOUND_DEVICE_H
@@ -9,6 +13,7 @@
 
 #include "config.h"
 #include "song.h"
+#include "synth.h"
 
 class SoundDevice {
 public:
@@ -17,87 +22,197 @@ public:
    * No @params
    * @return pointer to the instance of the class
    */
-  static getInstance() {
-    static SoundDevice *instance = new SoundDevice();
+  static SoundDevice *getInstance() {
+    static SoundDevice instance;
 
-    return instance;
+    return &instance;
   }
 
   /**
-   * Function that plays a note for a given duration on the sound device
+   * Function that plays a sound effect for a given duration on the sound device, on top of the song
    * @param note - the note frequency
    * @param duration - the note duration in millis to be played
    * No @return
    */
   void playSound(int note, int duration) {
-    tone(SOUND_DEVICE_PIN, note, duration);
+    // pick a free effect voice or the one closest to its end
+    byte effectVoice = SYNTH_MUSIC_VOICE + 1;
+    for (byte i = SYNTH_MUSIC_VOICE + 1; i < SYNTH_NUMBER_OF_VOICES; i++) {
+      if (synth->getVoiceSamplesLeft(i) < synth->getVoiceSamplesLeft(effectVoice)) {
+        effectVoice = i;
+      }
+    }
+    synth->playVoice(effectVoice, note, duration);
   }
 
   /**
-   * Function that removes any sound output on the sound device
+   * Function that removes any sound output on the sound device, stopping both the effects and the song
    * No @params
    * No @return
    */
   void removeSound() {
-    noTone(SOUND_DEVICE_PIN);
+    isSongPlaying = false;
+    isSongPaused = false;
+    synth->stopAllVoices();
   }
 
   /**
-   * Utility function to play the theme song
-   * Needs to be called in a loop, since at each call will play a note if timestamp on melody reached
-   * @param reset - boolean to request to start the song over again
+   * Function that starts playing a track from the start, replacing the one playing
+   * @param track - the index of the track in songTracks (TRACK_INTRO, TRACK_GAME or TRACK_GAME_OVER)
    * No @return
    */
-  void playSong(bool reset = false) {
-    static unsigned long lastUpdateTime = 0;
-    static int currentNote = 0;
-    static int noteDuration = 0;
-    static bool wasCurrentNotePlayed = false;
-
-    if (reset) {
-      currentNote = 0;
-      wasCurrentNotePlayed = false;
-      lastUpdateTime = millis();
+  void startSong(const byte track) {
+    memcpy_P(&currentTrack, &songTracks[track], sizeof(currentTrack));
+    wholeNoteDuration = (60000UL * 4) / currentTrack.tempo;
+    currentNote = 0;
+    loadCurrentNote();
+    noteStartTime = millis();
+    isSongPlaying = true;
+    isSongPaused = false;
+    isMusicOutputNeeded = true;
+  }
+
+  /**
+   * Function that stops the track playing, the effects playing are left to end by themselves
+   * No @params
+   * No @return
+   */
+  void stopSong() {
+    isSongPaused = false;
+    if (isSongPlaying) {
+      isSongPlaying = false;
+      synth->stopVoice(SYNTH_MUSIC_VOICE);
     }
+  }
 
-    if (!wasCurrentNotePlayed) {
-      int customDuration = melody[currentNote + 1];
-      if (customDuration > 0) { // if the encoded duration is positive, the note is a regular one
-        noteDuration = WHOLE_NOTE_DURATION / customDuration; // regular notes keep the same duration
-      } else { // if the encoded duration is negative, the note is a dotted one
-        noteDuration = WHOLE_NOTE_DURATION / abs(customDuration);
-        noteDuration *= 1.5; // increase duration with one half for dotted notes
-      }
+  /**
+   * Function that pauses the track playing where it is and silences the sound device, the synth's interrupt stops with
+   * the last voice
+   * No @params
+   * No @return
+   */
+  void pauseSong() {
+    if (isSongPlaying) {
+      isSongPlaying = false;
+      isSongPaused = true;
+      pausedNoteElapsedTime = millis() - noteStartTime;
+    }
+    synth->stopAllVoices();
+  }
+
+  /**
+   * Function that resumes the track paused with pauseSong() from the point it was paused
+   * No @params
+   * No @return
+   */
+  void resumeSong() {
+    if (isSongPaused) {
+      isSongPaused = false;
+      isSongPlaying = true;
+      noteStartTime = millis() - pausedNoteElapsedTime;
+      isMusicOutputNeeded = true;
+    }
+  }
 
-      // output to the sound device the frequency of the note with time scalled of the note duration
-      tone(SOUND_DEVICE_PIN, melody[currentNote], noteDuration * NOTE_DURATION_SCALAR);
-      wasCurrentNotePlayed = true;
-      lastUpdateTime = millis();
+  /**
+   * Function that plays the track started with startSong(), reading its notes from the Flash memory. The song's notes
+   * are timed from the start of the previous note and not from the call time, so the song doesn't drift when the calls
+   * are late. The effects end by themselves and don't need updating
+   * Needs to be called in a loop
+   * No @params
+   * No @return
+   */
+  void update() {
+    unsigned long currentTimestamp = millis();
+
+    if (!isSongPlaying) {
+      return;
     }
 
-    if (millis() - lastUpdateTime >= noteDuration) { // check if the note
-      noTone(SOUND_DEVICE_PIN); // remove any sound
-      currentNote += 2; // move to the next note freq
-      wasCurrentNotePlayed = false;
+    while (currentTimestamp - noteStartTime >= noteDuration) { // move to the next note
+      noteStartTime += noteDuration;
+      currentNote++;
+      if (currentNote == currentTrack.numberOfNotes) { // reached end of the song, loop or stop
+        currentNote = 0;
+        if (!currentTrack.isLooping) {
+          stopSong();
+          return;
+        }
+      }
+      loadCurrentNote();
+      isMusicOutputNeeded = true;
     }
 
-    if (currentNote == NUMBER_OF_NOTES * 2) { // reached end of the song, loop
-      currentNote = 0;
+    if (isMusicOutputNeeded) {
+      // output the part of the note left to be heard, a note started late is shorter
+      unsigned long noteElapsedTime = currentTimestamp - noteStartTime;
+      unsigned int audibleDuration = noteDuration * NOTE_DURATION_SCALAR;
+      if (noteFrequency != 0 && noteElapsedTime < audibleDuration) {
+        synth->playVoice(SYNTH_MUSIC_VOICE, noteFrequency, audibleDuration - noteElapsedTime);
+      } else { // rests only wait for their duration
+        synth->stopVoice(SYNTH_MUSIC_VOICE);
+      }
+      isMusicOutputNeeded = false;
     }
   }
 
 private:
+  // header of the track playing copied from the Flash memory, the notes are read from the Flash memory while playing
+  SongTrack currentTrack;
+  bool isSongPlaying = false;
+  bool isSongPaused = false;
+  unsigned long pausedNoteElapsedTime = 0; // time played of the current note when the track was paused
+  bool isMusicOutputNeeded = false;
+  unsigned int wholeNoteDuration = 0;
+  byte currentNote = 0;
+  unsigned int noteFrequency = 0;
+  unsigned int noteDuration = 0;
+  unsigned long noteStartTime = 0;
+
+  // synthesizer engine driving the sound device pin
+  Synth *synth = nullptr;
+
   /**
    * Private constructor for the singleton class
-   * The constructor initializes the sound device pins (in this case a single pin for the buzzer)
+   * The constructor gets the synthesizer engine that initializes the sound device pin (in this case a single pin for
+   * the buzzer)
    */
   SoundDevice() {
-    pinMode(SOUND_DEVICE_PIN, OUTPUT);
+    synth = Synth::getInstance();
   }
 
   SoundDevice(const SoundDevice &) = delete;
 
   SoundDevice &operator=(const SoundDevice &) = delete;
+
+  /**
+   * Function that decodes the current note of the track from the Flash memory into its frequency and duration
+   * No @params
+   * No @return
+   */
+  void loadCurrentNote() {
+    byte note = pgm_read_byte(&currentTrack.notes[currentNote]);
+    byte durationCode = note >> 5;
+    byte pitchCode = note & 0x1F;
+
+    noteDuration = wholeNoteDuration / pgm_read_byte(&durationDividers[durationCode]);
+    if (durationCode >= FIRST_DOTTED_DURATION) {
+      noteDuration += noteDuration / 2; // increase duration with one half for dotted notes
+    }
+    noteFrequency = pitchCode == 0 ? 0 : getNoteFrequency(currentTrack.baseNote + pitchCode - 1);
+  }
+
+  /**
+   * Function that computes the frequency of a note by halving the frequency of the same semitone from the highest
+   * octave, with rounding
+   * @param noteIndex - the note counted in semitones from C0
+   * @return the frequency of the note
+   */
+  static unsigned int getNoteFrequency(const byte noteIndex) {
+    byte octaveShift = HIGHEST_OCTAVE - noteIndex / SEMITONES_PER_OCTAVE;
+    unsigned int frequency = pgm_read_word(&highestOctaveFrequencies[noteIndex % SEMITONES_PER_OCTAVE]);
+    return (frequency + (1 << octaveShift >> 1)) >> octaveShift;
+  }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,135 @@
+/**
+ * File for the Stats class
+ * The Stats class is a singleton class that keeps the lifetime statistics of the unit: games played, food eaten, the
+ * longest snake, how the games ended and the play time. The counters are accumulated in memory and flushed once at the
+ * end of each game in the storage, in a ring of slots so the writes are spread over the ring, and only the bytes that
+ * differ from the older copy held by the slot are written
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "config.h"
+#include "enums.h"
+#include "storage.h"
+
+class Stats {
+public:
+  /**
+   * struct for the lifetime statistics for easier access to the data, and passing it around
+   * it allows for easier access to the data in the storage
+   */
+  struct StatsData {
+    uint32_t gamesPlayed;
+    uint32_t foodEaten;
+    uint32_t playTimeSeconds;
+    uint16_t gameEnds[NUMBER_OF_GAME_END_CAUSES]; // number of games ended by each GameEndCause
+    byte longestSnake;
+  };
+
+  static_assert(sizeof(StatsData) <= STATS_RECORD_CAPACITY, "the stats data don't fit in their record");
+
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Stats *getInstance() {
+    static Stats instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that adds a game that ended to the statistics and flushes them in the storage
+   * @param cause - how the game ended
+   * @param foodEaten - the food eaten in the game
+   * @param snakeLength - the length of the snake at the end of the game
+   * @param playTimeMillis - the play time of the game
+   * No @return
+   */
+  void recordGame(const GameEndCause cause, const byte foodEaten, const byte snakeLength,
+                  const unsigned long playTimeMillis) {
+    statsData.gamesPlayed++;
+    statsData.foodEaten += foodEaten;
+    statsData.gameEnds[(byte) cause]++;
+    statsData.longestSnake = max(statsData.longestSnake, snakeLength);
+
+    // keep the millis that don't make a whole second for the next game
+    playTimeRemainderMillis += playTimeMillis % 1000;
+    statsData.playTimeSeconds += playTimeMillis / 1000 + playTimeRemainderMillis / 1000;
+    playTimeRemainderMillis %= 1000;
+
+    Storage::getInstance()->save(StorageRecord::STATS, statsData);
+  }
+
+  /**
+   * Function that returns a statistic shown in the stats menu
+   * @param stat - the statistic, one of the STAT_* values
+   * @return the value of the statistic
+   */
+  unsigned long getStat(const byte stat) const {
+    switch (stat) {
+      case STAT_GAMES_PLAYED:
+        return statsData.gamesPlayed;
+      case STAT_FOOD_EATEN:
+        return statsData.foodEaten;
+      case STAT_LONGEST_SNAKE:
+        return statsData.longestSnake;
+      case STAT_WALL_DEATHS:
+        return statsData.gameEnds[(byte) GameEndCause::WALL];
+      case STAT_SELF_DEATHS:
+        return statsData.gameEnds[(byte) GameEndCause::SELF];
+      case STAT_STARVATION_DEATHS:
+        return statsData.gameEnds[(byte) GameEndCause::STARVATION];
+      case STAT_GAMES_WON:
+        return statsData.gameEnds[(byte) GameEndCause::WON];
+      case STAT_PLAY_TIME_MINUTES:
+        return statsData.playTimeSeconds / 60;
+      default:
+        return 0;
+    }
+  }
+
+  /**
+   * Function that writes the statistics on a stream as a line:
+   * STATS <games> <food> <longest> <wall deaths> <self deaths> <starvation deaths> <games won> <play time seconds>
+   * @param stream - the stream to write to
+   * No @return
+   */
+  void writeTo(Print &stream) const {
+    stream.print(F("STATS "));
+    stream.print(statsData.gamesPlayed);
+    stream.print(' ');
+    stream.print(statsData.foodEaten);
+    stream.print(' ');
+    stream.print(statsData.longestSnake);
+    for (byte i = 0; i < NUMBER_OF_GAME_END_CAUSES; i++) {
+      stream.print(' ');
+      stream.print(statsData.gameEnds[i]);
+    }
+    stream.print(' ');
+    stream.println(statsData.playTimeSeconds);
+  }
+
+private:
+  StatsData statsData;
+  unsigned int playTimeRemainderMillis = 0; // play time not counted yet in the seconds
+
+  /**
+   * Private constructor for the singleton class
+   * The constructor will load the statistics from the storage, all the counters start from 0 if no valid statistics
+   * are saved
+   */
+  Stats() {
+    if (!Storage::getInstance()->load(StorageRecord::STATS, statsData)) {
+      memset(&statsData, 0, sizeof(statsData));
+    }
+  }
+
+  Stats(const Stats &) = delete;
+
+  Stats &operator=(const Stats &) = delete;
+};
+
+#endif
@@ -0,0 +1,302 @@
+/**
+ * File for the Storage class
+ * The Storage class is a singleton class that saves records, like the settings or the highscores, in the EEPROM. Each
+ * record has its own ring of slots, and every save goes in the slot after the newest one, so the writes of a record are
+ * spread over all its slots and the last saved copy is left untouched until the new one is complete. A slot starts with
+ * a header: the version of the record, a sequence number that tells which slot is the newest and a CRC of the record,
+ * written after the payload. A slot cut by a power loss in the middle of a save fails the CRC check and the load falls
+ * back on the previous slot, and a record with no valid slot, after the first run or a change of the record's struct,
+ * makes the load fail so the caller applies its defaults. Only the bytes that differ from the older copy held by the
+ * slot are written in the EEPROM
+ */
+
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <EEPROM.h>
+#include <util/crc16.h>
+#include "config.h"
+
+// slot header: version, sequence number and the CRC of the record
+#define STORAGE_SLOT_HEADER_SIZE 4
+#define STORAGE_NO_SLOT 0xFF
+
+enum class StorageRecord : byte {
+  SETTINGS,
+  STATS,
+  SNAPSHOT,
+  FIRST_HIGHSCORES_BOARD, // a board for each difficulty level, the last records
+};
+
+/**
+ * struct for the place of a record in the EEPROM, saved in the Flash memory
+ */
+struct StorageRecordLayout {
+  unsigned int offset;
+  byte capacity; // the maximum size of the record
+  byte numberOfSlots;
+  byte version;
+};
+
+// size of the ring of slots of a record
+#define STORAGE_RING_SIZE(capacity, numberOfSlots) ((numberOfSlots) * (STORAGE_SLOT_HEADER_SIZE + (capacity)))
+
+// layout of the highscores board of a difficulty level, the boards are placed one after another
+#define HIGHSCORES_BOARD_LAYOUT(difficulty)                                                                            \
+  {HIGHSCORES_RECORD_OFFSET +                                                                                          \
+       ((difficulty) - MIN_DIFFICULTY_LEVEL) * STORAGE_RING_SIZE(HIGHSCORES_RECORD_CAPACITY, HIGHSCORES_RECORD_SLOTS), \
+   HIGHSCORES_RECORD_CAPACITY, HIGHSCORES_RECORD_SLOTS, HIGHSCORES_RECORD_VERSION}
+
+// layouts of the records indexed by StorageRecord
+static const StorageRecordLayout storageRecordLayouts[] PROGMEM = {
+    {SETTINGS_RECORD_OFFSET, SETTINGS_RECORD_CAPACITY, SETTINGS_RECORD_SLOTS, SETTINGS_RECORD_VERSION},
+    {STATS_RECORD_OFFSET, STATS_RECORD_CAPACITY, STATS_RECORD_SLOTS, STATS_RECORD_VERSION},
+    {SNAPSHOT_RECORD_OFFSET, SNAPSHOT_RECORD_CAPACITY, SNAPSHOT_RECORD_SLOTS, SNAPSHOT_RECORD_VERSION},
+    HIGHSCORES_BOARD_LAYOUT(1),
+    HIGHSCORES_BOARD_LAYOUT(2),
+    HIGHSCORES_BOARD_LAYOUT(3),
+    HIGHSCORES_BOARD_LAYOUT(4),
+};
+
+static_assert(sizeof(storageRecordLayouts) / sizeof(StorageRecordLayout) ==
+              (byte) StorageRecord::FIRST_HIGHSCORES_BOARD + MAX_DIFFICULTY_LEVEL - MIN_DIFFICULTY_LEVEL + 1,
+              "a highscores board layout is needed for each difficulty level");
+static_assert(SETTINGS_RECORD_OFFSET + STORAGE_RING_SIZE(SETTINGS_RECORD_CAPACITY, SETTINGS_RECORD_SLOTS) <=
+              HIGHSCORES_RECORD_OFFSET, "the settings slots overlap the highscores slots");
+static_assert(HIGHSCORES_RECORD_OFFSET + (MAX_DIFFICULTY_LEVEL - MIN_DIFFICULTY_LEVEL + 1) *
+              STORAGE_RING_SIZE(HIGHSCORES_RECORD_CAPACITY, HIGHSCORES_RECORD_SLOTS) <=
+              STATS_RECORD_OFFSET, "the highscores slots overlap the stats slots");
+static_assert(STATS_RECORD_OFFSET + STORAGE_RING_SIZE(STATS_RECORD_CAPACITY, STATS_RECORD_SLOTS) <=
+              GHOST_OFFSET_IN_STORAGE, "the stats slots overlap the ghost");
+static_assert(GHOST_OFFSET_IN_STORAGE + GHOST_SIZE_IN_STORAGE <= SNAPSHOT_RECORD_OFFSET,
+              "the ghost overlaps the snapshot slots");
+static_assert(SNAPSHOT_RECORD_OFFSET + STORAGE_RING_SIZE(SNAPSHOT_RECORD_CAPACITY, SNAPSHOT_RECORD_SLOTS) <=
+              STORAGE_SIZE, "the snapshot slots don't fit in the storage");
+
+class Storage {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Storage *getInstance() {
+    static Storage instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that loads a record from the newest valid slot of its ring
+   * @param record - the record to load
+   * @param data - the variable the record is loaded in, left unchanged if no slot is valid
+   * @return true if a valid slot was found, false if the caller has to apply the defaults
+   */
+  template<typename T>
+  bool load(const StorageRecord record, T &data) {
+    return loadRecord(record, (byte *) &data, sizeof(T));
+  }
+
+  /**
+   * Function that saves a record in the slot after the newest one of its ring. Nothing is written if the newest slot
+   * already holds the same record
+   * @param record - the record to save
+   * @param data - the variable saved
+   * No @return
+   */
+  template<typename T>
+  void save(const StorageRecord record, const T &data) {
+    saveRecord(record, (const byte *) &data, sizeof(T));
+  }
+
+  /**
+   * Function that checks if a record has a valid slot, without loading it
+   * @param record - the record to check
+   * @return true if a load of the record would succeed, false otherwise
+   */
+  template<typename T>
+  bool isSaved(const StorageRecord record) {
+    byte sequence = 0;
+    return findNewestSlot(record, getLayout(record), sizeof(T), sequence) != STORAGE_NO_SLOT;
+  }
+
+  /**
+   * Function that erases a record, corrupting the CRC of its valid slots so the next loads fail. The version and the
+   * sequence numbers are kept, so the next save still goes in the slot after the newest one
+   * @param record - the record to erase
+   * No @return
+   */
+  template<typename T>
+  void erase(const StorageRecord record) {
+    StorageRecordLayout layout = getLayout(record);
+    for (byte slot = 0; slot < layout.numberOfSlots; slot++) {
+      unsigned int address = getSlotAddress(layout, slot);
+      if (isSlotValid(record, layout, sizeof(T), address)) {
+        EEPROM.update(address + 3, (byte) ~EEPROM.read(address + 3));
+      }
+    }
+  }
+
+private:
+  /**
+   * Private constructor for the singleton class
+   */
+  Storage() {}
+
+  Storage(const Storage &) = delete;
+
+  Storage &operator=(const Storage &) = delete;
+
+  /**
+   * Function that loads a record from the newest valid slot of its ring
+   * @param record - the record to load
+   * @param data - the bytes the record is loaded in
+   * @param size - the size of the record
+   * @return true if a valid slot was found, false otherwise
+   */
+  bool loadRecord(const StorageRecord record, byte *data, const byte size) {
+    StorageRecordLayout layout = getLayout(record);
+    byte sequence = 0;
+    byte slot = findNewestSlot(record, layout, size, sequence);
+    if (slot == STORAGE_NO_SLOT) {
+      return false;
+    }
+
+    unsigned int address = getSlotAddress(layout, slot) + STORAGE_SLOT_HEADER_SIZE;
+    for (byte i = 0; i < size; i++) {
+      data[i] = EEPROM.read(address + i);
+    }
+    return true;
+  }
+
+  /**
+   * Function that saves a record in the slot after the newest one of its ring, valid or erased. The payload is written
+   * first and the header last, so the slot becomes the newest only when it is complete
+   * @param record - the record to save
+   * @param data - the bytes of the record
+   * @param size - the size of the record
+   * No @return
+   */
+  void saveRecord(const StorageRecord record, const byte *data, const byte size) {
+    StorageRecordLayout layout = getLayout(record);
+    byte sequence = 0;
+    byte slot = findNewestSlot(record, layout, size, sequence);
+    if (slot != STORAGE_NO_SLOT &&
+        isSlotPayloadEqual(getSlotAddress(layout, slot) + STORAGE_SLOT_HEADER_SIZE, data, size)) {
+      return; // the record didn't change since the last save
+    }
+
+    slot = findNewestSlot(record, layout, size, sequence, true);
+    if (slot != STORAGE_NO_SLOT) {
+      slot = (slot + 1) % layout.numberOfSlots;
+      sequence++;
+    } else {
+      slot = 0;
+    }
+
+    unsigned int address = getSlotAddress(layout, slot);
+    uint16_t crc = startCrc(record, layout.version, size, sequence);
+    for (byte i = 0; i < size; i++) {
+      EEPROM.update(address + STORAGE_SLOT_HEADER_SIZE + i, data[i]);
+      crc = _crc16_update(crc, data[i]);
+    }
+
+    EEPROM.update(address, layout.version);
+    EEPROM.update(address + 1, sequence);
+    EEPROM.update(address + 2, lowByte(crc));
+    EEPROM.update(address + 3, highByte(crc));
+  }
+
+  /**
+   * Function that finds the valid slot with the newest sequence number of a record. The sequence numbers are compared
+   * as a difference, so they can wrap around after 255
+   * @param record - the record
+   * @param layout - the layout of the record
+   * @param size - the size of the record, a slot saved with another size is not valid
+   * @param newestSequence - set to the sequence number of the newest slot
+   * @param isCrcIgnored - true to also take the slots of the current version with a wrong CRC, like the erased ones
+   * @return the index of the newest valid slot, or STORAGE_NO_SLOT if no slot is valid
+   */
+  byte findNewestSlot(const StorageRecord record, const StorageRecordLayout &layout, const byte size,
+                      byte &newestSequence, const bool isCrcIgnored = false) {
+    byte newestSlot = STORAGE_NO_SLOT;
+    for (byte slot = 0; slot < layout.numberOfSlots; slot++) {
+      unsigned int address = getSlotAddress(layout, slot);
+      byte sequence = EEPROM.read(address + 1);
+      if (isCrcIgnored ? EEPROM.read(address) != layout.version : !isSlotValid(record, layout, size, address)) {
+        continue;
+      }
+      if (newestSlot == STORAGE_NO_SLOT || (int8_t) (sequence - newestSequence) > 0) {
+        newestSlot = slot;
+        newestSequence = sequence;
+      }
+    }
+    return newestSlot;
+  }
+
+  /**
+   * Function that checks the version and the CRC of a slot
+   * @param record - the record saved in the slot
+   * @param layout - the layout of the record
+   * @param size - the size of the record
+   * @param address - the address of the slot
+   * @return true if the slot holds a complete record of the current version, false otherwise
+   */
+  bool isSlotValid(const StorageRecord record, const StorageRecordLayout &layout, const byte size,
+                   const unsigned int address) {
+    if (EEPROM.read(address) != layout.version) {
+      return false;
+    }
+
+    uint16_t crc = startCrc(record, layout.version, size, EEPROM.read(address + 1));
+    for (byte i = 0; i < size; i++) {
+      crc = _crc16_update(crc, EEPROM.read(address + STORAGE_SLOT_HEADER_SIZE + i));
+    }
+    return lowByte(crc) == EEPROM.read(address + 2) && highByte(crc) == EEPROM.read(address + 3);
+  }
+
+  /**
+   * Function that compares the payload of a slot with a record
+   * @param address - the address of the payload
+   * @param data - the bytes of the record
+   * @param size - the size of the record
+   * @return true if the payload and the record are the same, false otherwise
+   */
+  bool isSlotPayloadEqual(const unsigned int address, const byte *data, const byte size) {
+    for (byte i = 0; i < size; i++) {
+      if (EEPROM.read(address + i) != data[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Function that starts the CRC of a slot with the header fields, so a slot of another record, version or size is
+   * never taken as valid
+   * @param record - the record
+   * @param version - the version of the record
+   * @param size - the size of the record
+   * @param sequence - the sequence number of the slot
+   * @return the CRC of the header fields
+   */
+  static uint16_t startCrc(const StorageRecord record, const byte version, const byte size, const byte sequence) {
+    uint16_t crc = 0xFFFF;
+    crc = _crc16_update(crc, (byte) record);
+    crc = _crc16_update(crc, version);
+    crc = _crc16_update(crc, size);
+    return _crc16_update(crc, sequence);
+  }
+
+  static StorageRecordLayout getLayout(const StorageRecord record) {
+    StorageRecordLayout layout;
+    memcpy_P(&layout, &storageRecordLayouts[(byte) record], sizeof(layout));
+    return layout;
+  }
+
+  static unsigned int getSlotAddress(const StorageRecordLayout &layout, const byte slot) {
+    return layout.offset + STORAGE_RING_SIZE(layout.capacity, slot);
+  }
+};
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * File for the Synth class
+ * The Synth class is a singleton class for a direct digital synthesis engine on the sound device pin. Timer2 drives the
+ * pin 3 (OC2B) in fast PWM mode and its overflow interrupt mixes SYNTH_NUMBER_OF_VOICES square wave voices, each with
+ * its own phase accumulator, into the PWM duty cycle at SYNTH_SAMPLE_RATE. The voices play at the same time with an
+ * exact pitch and stop by themselves after their duration, without reconfiguring the timer on each note like tone().
+ * The interrupt is only enabled while a voice is playing. Counted from its code, not measured on the unit, it takes
+ * about 60 cycles to enter and leave and about 35 cycles per playing voice, so about 170 cycles with the 3 voices
+ * playing, out of the 1024 cycles between 2 samples: up to about 17% of the CPU while a sound plays
+ */
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <util/atomic.h>
+#include "config.h"
+
+/**
+ * struct for the state of a voice shared with the interrupt, written by the main loop only inside ATOMIC_BLOCK
+ */
+struct SynthVoice {
+  unsigned int phase;
+  unsigned int phaseIncrement;
+  unsigned int samplesLeft;
+};
+
+volatile SynthVoice synthVoices[SYNTH_NUMBER_OF_VOICES];
+
+/**
+ * Timer2 overflow interrupt, called once per sample: advances the phase of the playing voices and outputs the sum of
+ * their square waves as the PWM duty cycle. The interrupt disables itself when all the voices ended
+ * Each field of a voice is read once into a local and written back once. The main loop writes the voices only inside
+ * ATOMIC_BLOCK, so the interrupt never sees a voice half written
+ */
+ISR(TIMER2_OVF_vect) {
+  byte output = 0;
+  bool isAnyVoicePlaying = false;
+
+  for (byte i = 0; i < SYNTH_NUMBER_OF_VOICES; i++) {
+    volatile SynthVoice &voice = synthVoices[i];
+    unsigned int samplesLeft = voice.samplesLeft;
+    if (samplesLeft != 0) {
+      unsigned int phase = voice.phase + voice.phaseIncrement;
+      voice.samplesLeft = samplesLeft - 1;
+      voice.phase = phase;
+      if (phase & 0x8000) {
+        output += SYNTH_VOICE_AMPLITUDE;
+      }
+      isAnyVoicePlaying = true;
+    }
+  }
+
+  OCR2B = output;
+  if (!isAnyVoicePlaying) {
+    TIMSK2 &= ~_BV(TOIE2);
+  }
+}
+
+class Synth {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Synth *getInstance() {
+    static Synth instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that plays a frequency on a voice for a given duration, replacing what the voice was playing
+   * @param voice - the index of the voice
+   * @param frequency - the frequency to play
+   * @param duration - the duration in millis after which the voice stops by itself
+   * No @return
+   */
+  void playVoice(const byte voice, const unsigned int frequency, const unsigned long duration) {
+    unsigned int phaseIncrement = ((unsigned long) frequency << 16) / SYNTH_SAMPLE_RATE;
+    unsigned long samples = duration * SYNTH_SAMPLE_RATE / 1000;
+    if (samples > 0xFFFF) {
+      samples = 0xFFFF;
+    }
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+      synthVoices[voice].phaseIncrement = phaseIncrement;
+      synthVoices[voice].samplesLeft = samples;
+      TIMSK2 |= _BV(TOIE2);
+    }
+  }
+
+  /**
+   * Function that stops a voice
+   * @param voice - the index of the voice
+   * No @return
+   */
+  void stopVoice(const byte voice) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+      synthVoices[voice].samplesLeft = 0;
+    }
+  }
+
+  /**
+   * Function that stops all the voices
+   * No @params
+   * No @return
+   */
+  void stopAllVoices() {
+    for (byte i = 0; i < SYNTH_NUMBER_OF_VOICES; i++) {
+      stopVoice(i);
+    }
+  }
+
+  /**
+   * Function that returns how long a voice will still play
+   * @param voice - the index of the voice
+   * @return the number of samples left to be played by the voice, 0 if the voice is silent
+   */
+  unsigned int getVoiceSamplesLeft(const byte voice) const {
+    unsigned int samplesLeft;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+      samplesLeft = synthVoices[voice].samplesLeft;
+    }
+    return samplesLeft;
+  }
+
+private:
+  /**
+   * Private constructor for the singleton class
+   * The constructor sets Timer2 in fast PWM mode with OCR2A as top and the PWM output on OC2B (pin 3), with the
+   * overflow interrupt disabled until a voice plays
+   */
+  Synth() {
+    pinMode(SOUND_DEVICE_PIN, OUTPUT);
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+      TIMSK2 = 0;
+      TCCR2A = _BV(COM2B1) | _BV(WGM21) | _BV(WGM20);
+      TCCR2B = _BV(WGM22) | _BV(CS21);
+      OCR2A = SYNTH_TIMER_TOP;
+      OCR2B = 0;
+    }
+  }
+
+  Synth(const Synth &) = delete;
+
+  Synth &operator=(const Synth &) = delete;
+};
+
+#endif
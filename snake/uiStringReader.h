@@ -0,0 +1,114 @@
+/**
+ * File for the UiStringReader class
+ * The UiStringReader class decodes a UI string from the packed blob of uiStrings.h, one character at a time, so a
+ * string is never unpacked whole in the RAM. Each character is packed in 5 bits, the letters, the space, the period and
+ * the comma in a single code and the other characters after an escape code, see tools/compressUiStrings.py
+ */
+
+#ifndef UI_STRING_READER_H
+#define UI_STRING_READER_H
+
+#include "uiStrings.h"
+
+// codes of the packed characters besides the lowercase letters (0-25), must match tools/compressUiStrings.py
+#define UI_CODE_UPPER 26
+#define UI_CODE_SPACE 27
+#define UI_CODE_SYMBOL 28
+#define UI_CODE_RAW 29
+#define UI_CODE_PERIOD 30
+#define UI_CODE_COMMA 31
+
+/**
+ * Function that returns the number of characters of a UI string
+ * @param id - the id of the string
+ * @return the length of the string
+ */
+byte getUiStringLength(const UiStringId id) {
+  return pgm_read_byte(&uiStringLengths[id]);
+}
+
+class UiStringReader {
+public:
+  /**
+   * Function that moves the reader at the start of a string
+   * @param id - the id of the string to read
+   * No @return
+   */
+  void open(const UiStringId id) {
+    bitPosition = pgm_read_word(&uiStringOffsets[id]);
+    charsLeft = getUiStringLength(id);
+  }
+
+  /**
+   * Function that checks if the string has characters left to read
+   * No @params
+   * @return true if there are characters left, false otherwise
+   */
+  bool hasNext() const {
+    return charsLeft > 0;
+  }
+
+  /**
+   * Function that decodes the next character of the string
+   * Expected to be called only if hasNext() is true
+   * No @params
+   * @return the character
+   */
+  char next() {
+    charsLeft--;
+    byte code = readBits(5);
+    switch (code) {
+      case UI_CODE_UPPER:
+        return 'A' + readBits(5);
+      case UI_CODE_SPACE:
+        return ' ';
+      case UI_CODE_SYMBOL:
+        return pgm_read_byte(&uiStringSymbols[readBits(5)]);
+      case UI_CODE_RAW:
+        return readBits(8);
+      case UI_CODE_PERIOD:
+        return '.';
+      case UI_CODE_COMMA:
+        return ',';
+      default:
+        return 'a' + code;
+    }
+  }
+
+private:
+  unsigned int bitPosition = 0;
+  byte charsLeft = 0;
+
+  /**
+   * Function that reads the next bits of the blob, most significant bit first
+   * @param count - the number of bits to read, at most 8
+   * @return the bits read
+   */
+  byte readBits(byte count) {
+    byte value = 0;
+    while (count > 0) {
+      byte blobByte = pgm_read_byte(&uiStringsBlob[bitPosition >> 3]);
+      value = (value << 1) | ((blobByte >> (7 - (bitPosition & 0x07))) & 1);
+      bitPosition++;
+      count--;
+    }
+    return value;
+  }
+};
+
+/**
+ * Function that decodes a whole UI string in a buffer, without the string terminator
+ * @param destination - the buffer, with room for the length of the string
+ * @param id - the id of the string
+ * @return pointer after the last character written
+ */
+char *copyUiString(char *destination, const UiStringId id) {
+  UiStringReader reader;
+  reader.open(id);
+  while (reader.hasNext()) {
+    *destination++ = reader.next();
+  }
+  return destination;
+}
+
+#endif
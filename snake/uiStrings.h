@@ -0,0 +1,185 @@
+/**
+ * File generated by tools/compressUiStrings.py from tools/uiStrings.txt, don't edit it by hand
+ * The UI strings of the game packed in the Flash memory, decoded with a UiStringReader
+ * 52 strings, 848 bytes packed with the tables instead of 1006 bytes
+ */
+
+#ifndef UI_STRINGS_H
+#define UI_STRINGS_H
+
+enum UiStringId : byte {
+  INTRO_MESSAGE_STRING,
+  PRESS_SW_TO_SAVE_STRING,
+  PLACE_MESSAGE_PREFIX_STRING,
+  PLACE_MESSAGE_SUFFIX_STRING,
+  GAME_PAUSED_STRING,
+  NO_HIGHSCORE_MESSAGE_STRING,
+  BACK_STRING,
+  MAIN_TITLE_STRING,
+  PLAY_STRING,
+  CONTINUE_STRING,
+  NO_SAVED_GAME_STRING,
+  HIGHSCORES_STRING,
+  SETTINGS_STRING,
+  ABOUT_STRING,
+  HOW_TO_PLAY_STRING,
+  HIGHSCORES_TITLE_STRING,
+  STATS_STRING,
+  STATS_TITLE_STRING,
+  STAT_GAMES_PLAYED_STRING,
+  STAT_FOOD_EATEN_STRING,
+  STAT_LONGEST_SNAKE_STRING,
+  STAT_WALL_DEATHS_STRING,
+  STAT_SELF_DEATHS_STRING,
+  STAT_STARVATION_DEATHS_STRING,
+  STAT_GAMES_WON_STRING,
+  STAT_PLAY_TIME_MINUTES_STRING,
+  DIAGNOSTICS_TITLE_STRING,
+  DIAGNOSTIC_LOOPS_PER_SECOND_STRING,
+  DIAGNOSTIC_WORST_LOOP_MICROS_STRING,
+  DIAGNOSTIC_TICK_JITTER_STRING,
+  DIAGNOSTIC_LATE_TICKS_STRING,
+  DIAGNOSTIC_SKIPPED_TICKS_STRING,
+  DIAGNOSTIC_FREE_MEMORY_STRING,
+  DIAGNOSTIC_MIN_FREE_MEMORY_STRING,
+  DIAGNOSTIC_STACK_PEAK_STRING,
+  DIAGNOSTIC_LCD_BYTES_PER_SECOND_STRING,
+  DIAGNOSTIC_MATRIX_BYTES_PER_SECOND_STRING,
+  SETTINGS_TITLE_STRING,
+  CHANGE_NAME_STRING,
+  CHANGE_LCD_CONTRAST_STRING,
+  CHANGE_LCD_BRIGHTNESS_STRING,
+  CHANGE_MATRIX_BRIGHTNESS_STRING,
+  CHANGE_DIFFICULTY_STRING,
+  RESET_HIGHSCORES_STRING,
+  SOUND_ON_STRING,
+  SOUND_OFF_STRING,
+  ABOUT_TITLE_STRING,
+  ABOUT_GAME_TITLE_STRING,
+  ABOUT_AUTHOR_STRING,
+  ABOUT_GITHUB_STRING,
+  HOW_TO_PLAY_TITLE_STRING,
+  HOW_TO_PLAY_RULES_STRING,
+};
+
+#define INTRO_MESSAGE_STRING_LENGTH 26
+#define PRESS_SW_TO_SAVE_STRING_LENGTH 16
+#define PLACE_MESSAGE_PREFIX_STRING_LENGTH 27
+#define PLACE_MESSAGE_SUFFIX_STRING_LENGTH 53
+#define GAME_PAUSED_STRING_LENGTH 16
+#define NO_HIGHSCORE_MESSAGE_STRING_LENGTH 55
+#define BACK_STRING_LENGTH 4
+#define MAIN_TITLE_STRING_LENGTH 8
+#define PLAY_STRING_LENGTH 11
+#define CONTINUE_STRING_LENGTH 13
+#define NO_SAVED_GAME_STRING_LENGTH 13
+#define HIGHSCORES_STRING_LENGTH 10
+#define SETTINGS_STRING_LENGTH 8
+#define ABOUT_STRING_LENGTH 5
+#define HOW_TO_PLAY_STRING_LENGTH 12
+#define HIGHSCORES_TITLE_STRING_LENGTH 13
+#define STATS_STRING_LENGTH 10
+#define STATS_TITLE_STRING_LENGTH 12
+#define STAT_GAMES_PLAYED_STRING_LENGTH 5
+#define STAT_FOOD_EATEN_STRING_LENGTH 4
+#define STAT_LONGEST_SNAKE_STRING_LENGTH 7
+#define STAT_WALL_DEATHS_STRING_LENGTH 5
+#define STAT_SELF_DEATHS_STRING_LENGTH 4
+#define STAT_STARVATION_DEATHS_STRING_LENGTH 7
+#define STAT_GAMES_WON_STRING_LENGTH 3
+#define STAT_PLAY_TIME_MINUTES_STRING_LENGTH 8
+#define DIAGNOSTICS_TITLE_STRING_LENGTH 13
+#define DIAGNOSTIC_LOOPS_PER_SECOND_STRING_LENGTH 7
+#define DIAGNOSTIC_WORST_LOOP_MICROS_STRING_LENGTH 7
+#define DIAGNOSTIC_TICK_JITTER_STRING_LENGTH 6
+#define DIAGNOSTIC_LATE_TICKS_STRING_LENGTH 4
+#define DIAGNOSTIC_SKIPPED_TICKS_STRING_LENGTH 7
+#define DIAGNOSTIC_FREE_MEMORY_STRING_LENGTH 6
+#define DIAGNOSTIC_MIN_FREE_MEMORY_STRING_LENGTH 8
+#define DIAGNOSTIC_STACK_PEAK_STRING_LENGTH 7
+#define DIAGNOSTIC_LCD_BYTES_PER_SECOND_STRING_LENGTH 7
+#define DIAGNOSTIC_MATRIX_BYTES_PER_SECOND_STRING_LENGTH 7
+#define SETTINGS_TITLE_STRING_LENGTH 10
+#define CHANGE_NAME_STRING_LENGTH 11
+#define CHANGE_LCD_CONTRAST_STRING_LENGTH 19
+#define CHANGE_LCD_BRIGHTNESS_STRING_LENGTH 21
+#define CHANGE_MATRIX_BRIGHTNESS_STRING_LENGTH 24
+#define CHANGE_DIFFICULTY_STRING_LENGTH 17
+#define RESET_HIGHSCORES_STRING_LENGTH 16
+#define SOUND_ON_STRING_LENGTH 36
+#define SOUND_OFF_STRING_LENGTH 36
+#define ABOUT_TITLE_STRING_LENGTH 7
+#define ABOUT_GAME_TITLE_STRING_LENGTH 12
+#define ABOUT_AUTHOR_STRING_LENGTH 15
+#define ABOUT_GITHUB_STRING_LENGTH 31
+#define HOW_TO_PLAY_TITLE_STRING_LENGTH 14
+#define HOW_TO_PLAY_RULES_STRING_LENGTH 251
+
+static const char uiStringSymbols[] PROGMEM = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '!', '?', ':', ';', '\'', '"', '<', '>', '(', ')', '-', '=', '^', '/', '&', '+', '*', '#', '%', '@', '_', '['
+};
+
+static const byte uiStringLengths[] PROGMEM = {
+    26, 16, 27, 53, 16, 55, 4, 8, 11, 13, 13, 10, 8, 5, 12, 13,
+    10, 12, 5, 4, 7, 5, 4, 7, 3, 8, 13, 7, 7, 6, 4, 7,
+    6, 8, 7, 7, 7, 10, 11, 19, 21, 24, 17, 16, 36, 36, 7, 12,
+    15, 31, 14, 251
+};
+
+// offset in bits of each string in the blob
+static const unsigned int uiStringOffsets[] PROGMEM = {
+    0, 160, 255, 405, 705, 795, 1105, 1130, 1190, 1260, 1330, 1400,
+    1455, 1500, 1530, 1600, 1680, 1735, 1810, 1840, 1865, 1905, 1935, 1960,
+    2000, 2020, 2065, 2145, 2190, 2230, 2265, 2290, 2330, 2370, 2415, 2460,
+    2520, 2570, 2635, 2695, 2815, 2945, 3080, 3175, 3265, 3490, 3715, 3765,
+    3840, 3935, 4110, 4200
+};
+
+static const byte uiStringsBlob[] PROGMEM = {
+    0xD5, 0x88, 0xB1, 0x39, 0x84, 0xE2, 0xB7, 0xA5, 0x92, 0x7C, 0x74, 0xB6, 0xF5, 0x83, 0x1B, 0xD4,
+    0x9A, 0x05, 0x13, 0x8A, 0xD3, 0xE2, 0x49, 0x4B, 0x7A, 0x96, 0xAD, 0xB9, 0xBB, 0x72, 0x05, 0x49,
+    0xA1, 0x39, 0xA6, 0x88, 0x27, 0x2E, 0x2B, 0x7A, 0xC3, 0xA9, 0xB0, 0x44, 0x9B, 0x73, 0x76, 0xF5,
+    0x80, 0x44, 0xDE, 0xDC, 0xDD, 0x9D, 0x06, 0x3C, 0x84, 0xE8, 0x92, 0x5B, 0x0B, 0x81, 0x11, 0xEF,
+    0x8C, 0xE4, 0xF7, 0xCA, 0x6F, 0x4F, 0x89, 0x25, 0x2D, 0xEA, 0x5A, 0xB6, 0xE6, 0xED, 0xC8, 0x15,
+    0x26, 0xF9, 0x8D, 0x89, 0xCD, 0x9A, 0x1B, 0x42, 0x6A, 0x40, 0xA9, 0x07, 0xED, 0xF2, 0x1B, 0x9B,
+    0xB6, 0xC2, 0x36, 0x9A, 0xC3, 0xA9, 0xB1, 0xA0, 0x6D, 0xE3, 0xA7, 0xB0, 0x90, 0x13, 0xD8, 0x1B,
+    0x8D, 0x9D, 0x06, 0x3C, 0x84, 0xE8, 0x92, 0x5B, 0xE3, 0x39, 0x2D, 0xEF, 0x4F, 0x89, 0x25, 0x2D,
+    0xEA, 0x5A, 0xB6, 0xE6, 0xED, 0x89, 0xCD, 0x9A, 0x1B, 0x42, 0x68, 0x20, 0x12, 0xB9, 0x0D, 0x49,
+    0xA0, 0x51, 0x38, 0xAE, 0x47, 0x4F, 0x58, 0x31, 0xBD, 0x49, 0xA0, 0x51, 0x38, 0xAD, 0x09, 0xCD,
+    0x9A, 0x1B, 0x42, 0x6C, 0xC0, 0x61, 0x34, 0xD7, 0x6E, 0x40, 0xA9, 0x07, 0xB3, 0x01, 0x84, 0xD1,
+    0xD0, 0x63, 0xC8, 0x4E, 0x89, 0x25, 0xA9, 0x12, 0x73, 0x43, 0x4D, 0x2D, 0x00, 0x2E, 0xA4, 0xF4,
+    0x77, 0x5B, 0x73, 0x76, 0xDE, 0xB0, 0x63, 0x8B, 0xE4, 0x34, 0x74, 0x18, 0xF2, 0x13, 0xA2, 0x49,
+    0x6F, 0x43, 0xD4, 0xA6, 0x09, 0xA2, 0x53, 0x40, 0xA5, 0xC8, 0x6A, 0x53, 0x04, 0xD1, 0x29, 0xA0,
+    0x52, 0xE4, 0x74, 0x60, 0x30, 0x92, 0xD1, 0x5C, 0xE1, 0xE9, 0x6E, 0x69, 0x89, 0x29, 0xEA, 0xC0,
+    0x5A, 0xE5, 0xA9, 0x11, 0x65, 0xD4, 0xA6, 0x08, 0xD4, 0x83, 0xD5, 0x9C, 0xDD, 0x3D, 0x60, 0xC6,
+    0xD8, 0x86, 0xF2, 0x1A, 0x1A, 0x00, 0x66, 0xBA, 0x53, 0x40, 0xA5, 0xC8, 0xE9, 0x6E, 0x73, 0xE5,
+    0xCB, 0xCB, 0x4B, 0x73, 0x9F, 0xBA, 0x4B, 0x49, 0x44, 0xF6, 0xC9, 0x69, 0x60, 0x99, 0x35, 0x25,
+    0x21, 0xEF, 0x20, 0xF4, 0x58, 0x90, 0x9B, 0xD0, 0x74, 0xC4, 0x37, 0x65, 0x89, 0x09, 0xA9, 0x4C,
+    0x02, 0x56, 0xF4, 0x1D, 0x2F, 0x42, 0xD0, 0xF7, 0xA0, 0xF2, 0xF2, 0xD3, 0x27, 0x7D, 0xE8, 0x3C,
+    0xBC, 0xB9, 0x0D, 0x48, 0x93, 0x9A, 0x1A, 0x69, 0x72, 0x3A, 0x11, 0xC0, 0xD3, 0x13, 0x6D, 0x03,
+    0x09, 0xA1, 0x1C, 0x0D, 0x31, 0x37, 0xA5, 0xE8, 0x5A, 0x1E, 0xF4, 0x27, 0x36, 0x71, 0x04, 0xA7,
+    0xA1, 0x1C, 0x0D, 0x31, 0x37, 0xA5, 0xE8, 0x5A, 0x1E, 0xF4, 0x18, 0xA0, 0xC7, 0x9B, 0x49, 0x29,
+    0x68, 0x47, 0x03, 0x4C, 0x4D, 0xE9, 0x80, 0x9C, 0x51, 0x7D, 0xE8, 0x31, 0x41, 0x8F, 0x36, 0x92,
+    0x52, 0xD0, 0x8E, 0x06, 0x98, 0x9B, 0xD0, 0xD0, 0x52, 0xA0, 0x54, 0x5C, 0xF1, 0xA8, 0x92, 0x44,
+    0x9E, 0xF4, 0x74, 0x18, 0xF2, 0x13, 0xA2, 0x49, 0x6A, 0x4E, 0xA3, 0x47, 0xB4, 0x4B, 0x7A, 0x76,
+    0x9B, 0xED, 0xE9, 0xF1, 0x24, 0xA5, 0xBD, 0x4B, 0x56, 0xDC, 0xDD, 0xB9, 0xD2, 0x2D, 0xDA, 0x27,
+    0xBD, 0x3B, 0x45, 0xD1, 0x75, 0x27, 0x51, 0xA3, 0xDA, 0x25, 0xBD, 0x3B, 0x45, 0xD1, 0x7D, 0xBD,
+    0x3E, 0x24, 0x94, 0xB7, 0xA9, 0x6A, 0xDB, 0x9B, 0xB7, 0x3A, 0x45, 0xBB, 0x44, 0xF7, 0xA7, 0x69,
+    0xBC, 0x86, 0x80, 0x17, 0x52, 0x7C, 0x8E, 0xA6, 0x89, 0xAC, 0x9C, 0x66, 0xF5, 0x26, 0x81, 0x44,
+    0xD0, 0x71, 0xC6, 0x6F, 0x46, 0x23, 0xA2, 0x62, 0x6F, 0x51, 0x00, 0xE9, 0xA3, 0x22, 0x67, 0xA0,
+    0x77, 0x49, 0x12, 0x2D, 0x03, 0x09, 0xC6, 0x6C, 0xC4, 0x74, 0x4C, 0x4E, 0x52, 0x20, 0x1D, 0x39,
+    0x41, 0x4B, 0x90, 0xD1, 0xDD, 0x6D, 0xCD, 0xDB, 0x7A, 0xC1, 0x8E, 0x2F, 0x91, 0xD5, 0x24, 0x4D,
+    0xCC, 0xE4, 0xDA, 0x5D, 0x89, 0x4D, 0x02, 0x56, 0xE6, 0xED, 0xB1, 0xD5, 0x26, 0xF9, 0x6E, 0x42,
+    0xBC, 0x8F, 0xF6, 0x20, 0x37, 0x8E, 0x9E, 0xD8, 0xEA, 0x93, 0x63, 0x40, 0x0C, 0xE6, 0x81, 0x6B,
+    0xC7, 0xB7, 0xA2, 0x02, 0x7B, 0x03, 0xDE, 0xB2, 0x4B, 0x73, 0x76, 0xCD, 0x17, 0x5B, 0x60, 0x68,
+    0xF6, 0x62, 0x4F, 0x6F, 0x72, 0x1B, 0x39, 0x7B, 0x7A, 0x09, 0x36, 0x20, 0x44, 0x85, 0xA2, 0xD7,
+    0xB6, 0xBA, 0x7B, 0x9B, 0xB6, 0x40, 0x4F, 0x78, 0x75, 0x23, 0x22, 0x2C, 0xBB, 0x74, 0x76, 0x4B,
+    0xA2, 0x7B, 0x99, 0xC9, 0xB6, 0x02, 0x71, 0x45, 0xFD, 0xBD, 0x0D, 0xCD, 0xE3, 0xA7, 0xB3, 0x3B,
+    0x73, 0x73, 0xB6, 0xB7, 0x34, 0xDB, 0xB2, 0x26, 0x77, 0x52, 0x7B, 0x20, 0x26, 0x86, 0x9B, 0x6E,
+    0x8E, 0xF0, 0xEA, 0x6E, 0xC8, 0x5A, 0xF6, 0xB7, 0x48, 0x9B, 0x5A, 0x2A, 0x49, 0x7B, 0x7A, 0x3A,
+    0x0C, 0x72, 0x47, 0x63, 0x41, 0x4A, 0x81, 0x51, 0x73, 0xC6, 0xF9, 0x5E, 0x47, 0x67, 0x41, 0x8E,
+    0x48, 0xEE, 0x42, 0x74, 0x49, 0xED, 0xEA, 0x5A, 0xB6, 0xDE, 0x0A, 0x48, 0x92, 0xDF, 0x31, 0xB9,
+    0x02, 0xA4, 0x97, 0x80
+};
+
+#endif
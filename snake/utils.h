@@ -4,65 +4,129 @@
 #ifndef UTILS_H
 #define UTILS_H
 
-#include "settings.h"
-#include "highscores.h"
+#include <avr/sleep.h>
+#include <avr/wdt.h>
 #include "config.h"
 
 /**
- * Function to set the initial state of settings and highscores on the EEPROM to not read garbage data on the first run
+ * Function that creates a custom seed for the game's random generator with some entropy from the readings on the
+ * arduino's analog pins
+ * No @params
+ * @return the seed created, never 0 since the xorshift generator can't leave the all zeros state
+ */
+unsigned long generateRandomSeed() {
+  // get some entropy
+  int r = 0;
+  for (int i = A0; i <= A7; i++) {
+    r += analogRead(i);
+  }
+
+  unsigned long seed = ((unsigned long) r << 10) ^ ((uint32_t) analogRead(0) << 22) ^ micros();
+  return seed ? seed : 1;
+}
+
+/**
+ * Function that advances a xorshift32 random generator state. The game uses its own generator instead of random()
+ * so a game can be replayed the same on any board or host build given the seed
+ * @param state - the current state of the generator, must not be 0
+ * @return the next state of the generator
+ */
+unsigned long getNextRandomState(unsigned long state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+/**
+ * Function that restarts the watchdog timer. Called by the main loop and by the code blocking it for a while, so the
+ * watchdog only resets the unit when the loop stalls
  * No @params
  * No @return
  */
-void initDefaultDataInStorage() {
-  Settings *settings = Settings::getInstance();
-  Highscores *highscores = Highscores::getInstance();
+void feedWatchdog() {
+  wdt_reset();
+}
 
-  settings->setLcdContrast(MAX_LCD_CONTRAST_BLOCK_COUNT / 2);
-  settings->setLcdBrightness(MAX_LCD_BRIGHTNESS_BLOCK_COUNT / 2);
-  settings->setMatrixBrightness(MAX_MATRIX_BRIGHTNESS_BLOCK_COUNT / 2);
-  settings->setGameDifficulty(MAX_DIFFICULTY_BLOCK_COUNT / 2);
-  settings->setIsSoundOn(true);
-  settings->setPlayerName("NO 0NE");
-  highscores->resetHighscores();
+/**
+ * Function that reads a character from a stream waiting at most SERIAL_READ_TIMEOUT millis for it to arrive
+ * @param stream - the stream to read from
+ * @return the character read or -1 on timeout
+ */
+int readCharFromStream(Stream &stream) {
+  unsigned long startTimestamp = millis();
+  while (millis() - startTimestamp < SERIAL_READ_TIMEOUT) {
+    feedWatchdog();
+    if (stream.available()) {
+      return stream.read();
+    }
+  }
+  return -1;
+}
+
+/**
+ * Function that reads a whitespace separated token from a stream. Characters that don't fit in the token are dropped
+ * @param stream - the stream to read from
+ * @param token - buffer to save the token into, will be null terminated
+ * @param maxLength - the max number of characters the token buffer can hold without the null terminator
+ * @return true if a token was read, false on timeout
+ */
+bool readTokenFromStream(Stream &stream, char *token, const byte maxLength) {
+  byte length = 0;
+  int c;
+  do { // skip leading whitespaces
+    c = readCharFromStream(stream);
+  } while (c == ' ' || c == '\r' || c == '\n');
+
+  while (c != -1 && c != ' ' && c != '\r' && c != '\n') {
+    if (length < maxLength) {
+      token[length++] = c;
+    }
+    c = readCharFromStream(stream);
+  }
+  token[length] = '\0';
 
-  settings->saveInStorage();
-  highscores->saveInStorage();
+  return length > 0;
 }
 
 /**
- * Function that returns the size of a string saved in the Flash memory
- * Function created since strlen_P didn't give me the right values for some reasons
- * implementation idea taken from the function: (line 44) size_t Print::print(const __FlashStringHelper *ifsh) from arduino Print
- * link: https://github.com/arduino/ArduinoCore-avr/blob/master/cores/arduino/Print.cpp
- * @param fs - pointer to the string saved in Flash memory
- * @return the size of the string
+ * Function that reads an unsigned number written in hexadecimal from a stream
+ * @param stream - the stream to read from
+ * @param value - reference to save the value read into
+ * @return true if a valid number was read, false otherwise
  */
-size_t getLengthOfFlashString(const __FlashStringHelper *fs) {
-  PGM_P p = reinterpret_cast<PGM_P>(fs);
-  size_t n = 0;
-  while (true) {
-    unsigned char c = pgm_read_byte(p++);
-    if (c == 0) { break; }
-    n++;
+bool readHexNumberFromStream(Stream &stream, unsigned long &value) {
+  char token[9];
+  if (!readTokenFromStream(stream, token, 8)) {
+    return false;
   }
-  return n;
+
+  char *end = nullptr;
+  value = strtoul(token, &end, 16);
+  return *end == '\0';
 }
 
 /**
- * Function that seeds the random system with a custom seed created with some entropy from the readings on the
- * arduino's analog pins
- * No @params
+ * Function that drops everything from a stream until the end of the current line
+ * @param stream - the stream to read from
  * No @return
  */
-void configureRandomSeed() {
-  // get some entropy
-  int r = 0;
-  for (int i = A0; i <= A7; i++) {
-    r += analogRead(i);
-  }
+void skipLineFromStream(Stream &stream) {
+  int c;
+  do {
+    c = readCharFromStream(stream);
+  } while (c != -1 && c != '\n');
+}
 
-  randomSeed(r);
-  randomSeed(random() ^ ((uint32_t) analogRead(0) << 22) ^ micros());
+/**
+ * Function that puts the MCU in the idle sleep mode until the next interrupt. The timers and their interrupts keep
+ * running, so the Timer0 interrupt of millis() wakes the MCU up at least every ~1ms
+ * No @params
+ * No @return
+ */
+void sleepUntilNextInterrupt() {
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_mode();
 }
 
 #endif
\ No newline at end of file
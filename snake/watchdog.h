@@ -0,0 +1,95 @@
+/**
+ * File for the Watchdog class
+ * The Watchdog class is a singleton class that resets the unit when the main loop stalls. The watchdog timer runs in
+ * the interrupt and reset mode: when it isn't fed with feedWatchdog() for a timeout, its interrupt leaves a mark in a
+ * variable kept over resets and waits for the reset made at the next timeout. The mark doesn't depend on the
+ * bootloader keeping the MCUSR reset flags, so after a watchdog reset the game starts in the main menu instead of the
+ * intro. The watchdog is started only if WATCHDOG_ENABLED is set
+ */
+
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include <avr/wdt.h>
+#include "config.h"
+#include "utils.h"
+
+// not cleared at boot, so they keep their values over a reset
+unsigned int watchdogResetMark __attribute__((section(".noinit")));
+byte resetFlags __attribute__((section(".noinit")));
+
+/**
+ * Function that saves the reset flags and stops the watchdog before main() runs, since after a watchdog reset the
+ * watchdog keeps running with its shortest timeout. It is placed in the .init3 section, before the static data is
+ * initialized, and is naked so it doesn't use the stack
+ * No @params
+ * No @return
+ */
+void readResetFlags() __attribute__((naked, used, section(".init3")));
+
+void readResetFlags() {
+  resetFlags = MCUSR;
+  MCUSR = 0;
+  wdt_disable();
+}
+
+/**
+ * Watchdog interrupt, called at the first timeout: marks the reset and waits for it at the next timeout, so a stalled
+ * loop is never resumed and the mark is never left behind
+ */
+ISR(WDT_vect) {
+  watchdogResetMark = WATCHDOG_RESET_MARK;
+  while (true) {}
+}
+
+class Watchdog {
+public:
+  /**
+   * Static method to get a pointer to the instance of the class
+   * No @params
+   * @return pointer to the instance of the class
+   */
+  static Watchdog *getInstance() {
+    static Watchdog instance;
+
+    return &instance;
+  }
+
+  /**
+   * Function that starts the watchdog in the interrupt and reset mode if WATCHDOG_ENABLED is set, from then on the
+   * main loop needs to call feedWatchdog() on each iteration
+   * No @params
+   * No @return
+   */
+  void start() {
+#if WATCHDOG_ENABLED
+    cli();
+    feedWatchdog();
+    WDTCSR = _BV(WDCE) | _BV(WDE); // timed sequence to change the prescaler
+    WDTCSR = _BV(WDIE) | _BV(WDE) | WATCHDOG_PRESCALER_BITS;
+    sei();
+#endif
+  }
+
+  bool getWasStalled() const {
+    return wasStalled;
+  }
+
+private:
+  bool wasStalled = false; // the last reset was made by the watchdog
+
+  /**
+   * Private constructor for the singleton class
+   * The constructor will check if the last reset was made by the watchdog, from its mark or from the reset flags
+   */
+  Watchdog() {
+    wasStalled = watchdogResetMark == WATCHDOG_RESET_MARK || (resetFlags & _BV(WDRF));
+    watchdogResetMark = 0;
+  }
+
+  Watchdog(const Watchdog &) = delete;
+
+  Watchdog &operator=(const Watchdog &) = delete;
+};
+
+#endif
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Compresses the UI strings of the game from uiStrings.txt into snake/uiStrings.h, a single bit-packed PROGMEM blob
+decoded by the UiStringReader from snake/uiStringReader.h.
+
+Each character is packed in 5 bits:
+- 0-25: lowercase letter
+- 26: the next 5 bits are an uppercase letter
+- 27: space
+- 28: the next 5 bits index a symbol in the symbols table
+- 29: the next 8 bits are the character itself, for characters not in the tables
+- 30: '.'
+- 31: ','
+The codes must match the UI_CODE_* values of snake/uiStringReader.h.
+
+Usage: python3 tools/compressUiStrings.py (from the repository root)
+"""
+
+import os
+import sys
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+INPUT_PATH = os.path.join(TOOLS_DIR, "uiStrings.txt")
+OUTPUT_PATH = os.path.join(TOOLS_DIR, "..", "snake", "uiStrings.h")
+
+CODE_UPPER = 26
+CODE_SPACE = 27
+CODE_SYMBOL = 28
+CODE_RAW = 29
+CODE_PERIOD = 30
+CODE_COMMA = 31
+SYMBOLS = "0123456789!?:;'\"<>()-=^/&+*#%@_["
+MAX_STRING_LENGTH = 255
+
+
+def read_strings(path):
+    strings = []
+    with open(path, encoding="ascii") as file:
+        for line_number, line in enumerate(file, 1):
+            line = line.rstrip("\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+            name, separator, text = line.partition(" = ")
+            if not separator:
+                sys.exit(f"{path}:{line_number}: expected 'ID = text'")
+            if len(text) > MAX_STRING_LENGTH:
+                sys.exit(f"{path}:{line_number}: {name} is longer than {MAX_STRING_LENGTH} characters")
+            strings.append((name.strip(), text))
+    return strings
+
+
+def encode_char(c):
+    """Returns the (value, bit count) fields encoding a character."""
+    if "a" <= c <= "z":
+        return [(ord(c) - ord("a"), 5)]
+    if "A" <= c <= "Z":
+        return [(CODE_UPPER, 5), (ord(c) - ord("A"), 5)]
+    if c == " ":
+        return [(CODE_SPACE, 5)]
+    if c == ".":
+        return [(CODE_PERIOD, 5)]
+    if c == ",":
+        return [(CODE_COMMA, 5)]
+    if c in SYMBOLS:
+        return [(CODE_SYMBOL, 5), (SYMBOLS.index(c), 5)]
+    return [(CODE_RAW, 5), (ord(c), 8)]
+
+
+def compress(strings):
+    bits = []
+    offsets = []
+    for _, text in strings:
+        offsets.append(len(bits))
+        for c in text:
+            for value, count in encode_char(c):
+                bits.extend((value >> i) & 1 for i in reversed(range(count)))
+    bits.extend([0] * (-len(bits) % 8))
+    blob = [int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8)]
+    return blob, offsets
+
+
+def format_rows(values, per_row):
+    return ",\n".join("    " + ", ".join(values[i:i + per_row]) for i in range(0, len(values), per_row))
+
+
+def main():
+    strings = read_strings(INPUT_PATH)
+    blob, offsets = compress(strings)
+    if offsets[-1] > 0xFFFF:
+        sys.exit("the strings don't fit in 16 bit offsets")
+
+    raw_size = sum(len(text) + 1 for _, text in strings)
+    packed_size = len(blob) + 3 * len(strings)
+    symbols = ", ".join("'\\''" if c == "'" else f"'{c}'" for c in SYMBOLS)
+    output = [
+        "/**",
+        " * File generated by tools/compressUiStrings.py from tools/uiStrings.txt, don't edit it by hand",
+        " * The UI strings of the game packed in the Flash memory, decoded with a UiStringReader",
+        f" * {len(strings)} strings, {packed_size} bytes packed with the tables instead of {raw_size} bytes",
+        " */",
+        "",
+        "#ifndef UI_STRINGS_H",
+        "#define UI_STRINGS_H",
+        "",
+        "enum UiStringId : byte {",
+    ]
+    output += [f"  {name}_STRING," for name, _ in strings]
+    output += ["};", ""]
+    output += [f"#define {name}_STRING_LENGTH {len(text)}" for name, text in strings]
+    output += [
+        "",
+        "static const char uiStringSymbols[] PROGMEM = {",
+        f"    {symbols}",
+        "};",
+        "",
+        "static const byte uiStringLengths[] PROGMEM = {",
+        format_rows([str(len(text)) for _, text in strings], 16),
+        "};",
+        "",
+        "// offset in bits of each string in the blob",
+        "static const unsigned int uiStringOffsets[] PROGMEM = {",
+        format_rows([str(offset) for offset in offsets], 12),
+        "};",
+        "",
+        "static const byte uiStringsBlob[] PROGMEM = {",
+        format_rows([f"0x{value:02X}" for value in blob], 16),
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    with open(OUTPUT_PATH, "w", encoding="ascii", newline="\n") as file:
+        file.write("\n".join(output))
+    print(f"{len(strings)} strings: {raw_size} bytes -> {packed_size} bytes")
+
+
+if __name__ == "__main__":
+    main()